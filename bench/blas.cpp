@@ -0,0 +1,61 @@
+// The BLAS level 1 kernels in GB/s of array traffic, at sizes from L1
+// resident up to the one given on the command line (default 2^26 floats),
+// with a dot product over a single Vec8f accumulator for comparison.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/blas.cpp -o blas
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Best GB/s for run moving bytes, over enough repeats to move at least 4 GB
+template <typename Run>
+static double bandwidth(double bytes, Run run) {
+  i64 repeats = SVL_MAX(i64(3), i64(4e9 / bytes));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  return bytes / best * 1e-9;
+}
+
+// Keeps results alive without the cost of a store per call mattering
+static volatile flt sink;
+
+int main(int argc, char** argv) {
+  i64 max_n = argc > 1 ? std::atoll(argv[1]) : i64(1) << 26;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+
+  printf("GB/s\n%10s %10s %10s %10s %10s %10s %10s\n", "n", "naive dot", "dot", "axpy", "scal",
+         "asum", "nrm2");
+  for (i64 n = 1024; n <= max_n; n *= 4) {
+    std::vector<flt> x(n), y(n);
+    for (flt& v : x) v = dis(gen);
+    for (flt& v : y) v = dis(gen);
+    const double bytes = double(n) * sizeof(flt);
+
+    double naive = bandwidth(2 * bytes, [&]() {
+      SVL::Vec8f acc = SVL::Vec8f::zeros();
+      for (i64 i = 0; i + 8 <= n; i += 8) acc = fma(SVL::Vec8f(&x[i]), SVL::Vec8f(&y[i]), acc);
+      sink = horizontal_add(acc);
+    });
+    double dot = bandwidth(2 * bytes, [&]() { sink = SVL::dot(n, x.data(), y.data()); });
+    // axpy and scal read and write, and stay in range as 1e-7 is tiny
+    double axpy = bandwidth(3 * bytes, [&]() { SVL::axpy(n, 1e-7f, x.data(), y.data()); });
+    double scal = bandwidth(2 * bytes, [&]() { SVL::scal(n, 1.f + 1e-7f, y.data()); });
+    double asum = bandwidth(bytes, [&]() { sink = SVL::asum(n, x.data()); });
+    double nrm2 = bandwidth(bytes, [&]() { sink = SVL::nrm2(n, x.data()); });
+    printf("%10lld %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", (long long)n, naive, dot, axpy,
+           scal, asum, nrm2);
+  }
+  return 0;
+}
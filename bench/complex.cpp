@@ -0,0 +1,75 @@
+// The complex array kernels in GB/s of array traffic, against the same loops
+// over std::complex<float>, at sizes from L1 resident up to the one given on
+// the command line (default 2^24 complex numbers).
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/complex.cpp -o complex
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using cflt = std::complex<flt>;
+
+// Best GB/s for run moving bytes, over enough repeats to move at least 4 GB
+template <typename Run>
+static double bandwidth(double bytes, Run run) {
+  i64 repeats = SVL_MAX(i64(3), i64(4e9 / bytes));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  return bytes / best * 1e-9;
+}
+
+// Keeps results alive without the cost of a store per call mattering
+static volatile flt sink;
+
+int main(int argc, char** argv) {
+  i64 max_n = argc > 1 ? std::atoll(argv[1]) : i64(1) << 24;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+
+  printf("GB/s\n%10s %10s %10s %10s %10s %10s %10s\n", "n", "std mul", "multiply", "std mac",
+         "mac", "std dot", "dot");
+  for (i64 n = 512; n <= max_n; n *= 4) {
+    std::vector<cflt> a(n), b(n), c(n);
+    for (cflt& v : a) v = cflt(dis(gen), dis(gen));
+    for (cflt& v : b) v = cflt(dis(gen), dis(gen)) * 1e-4f;
+    for (cflt& v : c) v = cflt(dis(gen), dis(gen));
+    const double bytes = double(n) * sizeof(cflt);
+
+    double std_mul = bandwidth(3 * bytes, [&]() {
+      for (i64 i = 0; i < n; ++i) c[i] = a[i] * b[i];
+    });
+    double mul = bandwidth(3 * bytes, [&]() {
+      SVL::complex_multiply(n, a.data(), b.data(), c.data());
+    });
+    // The products are small, so repeated accumulation stays in range
+    double std_mac = bandwidth(4 * bytes, [&]() {
+      for (i64 i = 0; i < n; ++i) c[i] += a[i] * b[i];
+    });
+    double mac = bandwidth(4 * bytes, [&]() {
+      SVL::complex_mac(n, a.data(), b.data(), c.data());
+    });
+    double std_dot = bandwidth(2 * bytes, [&]() {
+      cflt sum = 0.f;
+      for (i64 i = 0; i < n; ++i) sum += a[i] * b[i];
+      sink = sum.real();
+    });
+    double dot = bandwidth(2 * bytes, [&]() {
+      sink = SVL::complex_dot(n, a.data(), b.data()).real();
+    });
+    printf("%10lld %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", (long long)n, std_mul, mul,
+           std_mac, mac, std_dot, dot);
+  }
+  return 0;
+}
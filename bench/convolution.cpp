@@ -0,0 +1,114 @@
+// FIR filters and 2D convolutions in GFLOPS (2 flops per tap per output),
+// against scalar loops and a vector loop that loads every window with an
+// unaligned load. FIRs run over 2^16 samples at several tap counts, and 2D
+// convolutions over a 1920 x 1080 image at kernel sizes from 3 x 3 to 7 x 7,
+// also on all threads.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/convolution.cpp -o convolution -pthread
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Best GFLOPS for run doing flops, over enough repeats for at least 1e9 flops
+template <typename Run>
+static double gflops(double flops, Run run) {
+  i64 repeats = SVL_MAX(i64(3), i64(1e9 / flops));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  return flops / best * 1e-9;
+}
+
+static void scalar_fir(i64 n, const flt* in, const flt* taps, i64 k, flt* out) {
+  for (i64 i = 0; i < n; ++i) {
+    flt sum = 0.f;
+    for (i64 j = 0; j < k; ++j) sum += taps[j] * in[i + k - 1 - j];
+    out[i] = sum;
+  }
+}
+
+// One output register at a time, loading every window
+static void loads_fir(i64 n, const flt* in, const flt* taps, i64 k, flt* out) {
+  i64 i = 0;
+  for (; i + i64(SVL::Vec8f::step) <= n; i += SVL::Vec8f::step) {
+    SVL::Vec8f acc = SVL::Vec8f::zeros();
+    for (i64 j = 0; j < k; ++j) acc = fma(SVL::Vec8f(taps[j]), SVL::Vec8f(in + i + k - 1 - j), acc);
+    acc.store(out + i);
+  }
+  scalar_fir(n - i, in + i, taps, k, out + i);
+}
+
+static void scalar_conv2d(i64 rows, i64 cols, const flt* in, i64 in_stride, const flt* kernel,
+                          i64 kr, i64 kc, flt* out) {
+  for (i64 r = 0; r < rows; ++r)
+    for (i64 c = 0; c < cols; ++c) {
+      flt sum = 0.f;
+      for (i64 i = 0; i < kr; ++i)
+        for (i64 j = 0; j < kc; ++j)
+          sum += kernel[i * kc + j] * in[(r + kr - 1 - i) * in_stride + c + kc - 1 - j];
+      out[r * cols + c] = sum;
+    }
+}
+
+int main() {
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+
+  const i64 n = i64(1) << 16;
+  printf("FIR GFLOPS\n%6s %10s %10s %10s\n", "taps", "scalar", "loads", "fir");
+  for (i64 k : { 3, 7, 16, 31, 64, 127 }) {
+    std::vector<flt> in(n + k - 1), taps(k), out(n);
+    for (flt& v : in) v = dis(gen);
+    for (flt& v : taps) v = dis(gen);
+    const double flops = 2. * dbl(n) * dbl(k);
+    double scalar = gflops(flops, [&]() { scalar_fir(n, in.data(), taps.data(), k, out.data()); });
+    double loads = gflops(flops, [&]() { loads_fir(n, in.data(), taps.data(), k, out.data()); });
+    double fir = gflops(flops, [&]() { SVL::fir(n, in.data(), taps.data(), k, out.data()); });
+    printf("%6lld %10.2f %10.2f %10.2f\n", (long long)k, scalar, loads, fir);
+  }
+
+  const i64 rows = 1080, cols = 1920;
+  printf("\n2D GFLOPS, %lld x %lld\n%6s %10s %10s %10s %10s %10s\n", (long long)cols,
+         (long long)rows, "kernel", "scalar", "conv2d", "parallel", "separable", "parallel");
+  for (i64 k : { 3, 5, 7 }) {
+    const i64 stride = cols + k - 1;
+    std::vector<flt> in((rows + k - 1) * stride), kernel(k * k), row(k), column(k);
+    std::vector<flt> out(rows * cols);
+    for (flt& v : in) v = dis(gen);
+    for (flt& v : row) v = dis(gen);
+    for (flt& v : column) v = dis(gen);
+    for (i64 i = 0; i < k; ++i)
+      for (i64 j = 0; j < k; ++j) kernel[i * k + j] = column[i] * row[j];
+    // Separable rates count the flops of the full kernel, for comparison
+    const double flops = 2. * dbl(rows) * dbl(cols) * dbl(k * k);
+    double scalar = gflops(flops, [&]() {
+      scalar_conv2d(rows, cols, in.data(), stride, kernel.data(), k, k, out.data());
+    });
+    double general = gflops(flops, [&]() {
+      SVL::conv2d(rows, cols, in.data(), stride, kernel.data(), k, k, out.data(), cols);
+    });
+    double parallel = gflops(flops, [&]() {
+      SVL::parallel_conv2d(rows, cols, in.data(), stride, kernel.data(), k, k, out.data(), cols);
+    });
+    double separable = gflops(flops, [&]() {
+      SVL::conv2d_separable(rows, cols, in.data(), stride, row.data(), k, column.data(), k,
+                            out.data(), cols);
+    });
+    double parallel_separable = gflops(flops, [&]() {
+      SVL::parallel_conv2d_separable(rows, cols, in.data(), stride, row.data(), k,
+                                     column.data(), k, out.data(), cols);
+    });
+    printf("%3lldx%-2lld %10.2f %10.2f %10.2f %10.2f %10.2f\n", (long long)k, (long long)k, scalar,
+           general, parallel, separable, parallel_separable);
+  }
+  return 0;
+}
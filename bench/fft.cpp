@@ -0,0 +1,112 @@
+// FFT throughput in GFLOPS, counting 5 n log2(n) flops per complex transform
+// and half that per real one, at sizes up to the one given on the command
+// line (default 2^20). Complex transforms are timed as forward and inverse
+// pairs, which scale the data by n, followed by a pass scaling it back.
+// Batched transforms run 2^22 / n rows at once over all threads, and are few
+// enough repeats that they needn't be scaled back. Each
+// size up to 2^12 is also checked against a naive double precision DFT, as
+// the largest error relative to the root mean square output, and the naive
+// DFT's own rate (8 n^2 flops) is shown for scale.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/fft.cpp -o fft -pthread
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using cdbl = std::complex<dbl>;
+
+// Best GFLOPS for run doing flops, over enough repeats for at least 1e9 flops
+template <typename Run>
+static double gflops(double flops, Run run) {
+  i64 repeats = SVL_MAX(i64(3), i64(1e9 / flops));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  return flops / best * 1e-9;
+}
+
+// Naive forward DFT of re + i im
+static void dft(i64 n, const flt* re, const flt* im, cdbl* out) {
+  for (i64 k = 0; k < n; ++k) {
+    cdbl sum = 0.;
+    for (i64 j = 0; j < n; ++j) {
+      const dbl angle = -6.283185307179586477 * dbl(j * k % n) / dbl(n);
+      sum += cdbl(re[j], im[j]) * cdbl(std::cos(angle), std::sin(angle));
+    }
+    out[k] = sum;
+  }
+}
+
+int main(int argc, char** argv) {
+  i64 max_n = argc > 1 ? std::atoll(argv[1]) : i64(1) << 20;
+  const i64 threads = SVL_MAX(i64(1), i64(std::thread::hardware_concurrency()));
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+
+  printf("GFLOPS\n%10s %10s %10s %10s %10s %12s\n", "n", "complex", "real", "batched",
+         "naive dft", "error");
+  for (i64 n = 16; n <= max_n; n *= 2) {
+    const i64 log_n = i64(std::log2(dbl(n)));
+    const double flops = 5. * dbl(n) * dbl(log_n);
+    std::vector<flt> re(n), im(n), x(n), out_re(n / 2 + 1), out_im(n / 2 + 1);
+    for (flt& v : re) v = dis(gen);
+    for (flt& v : im) v = dis(gen);
+    for (flt& v : x) v = dis(gen);
+    const SVL::FFTPlan<>& plan = SVL::fft_plan(n);
+    const SVL::RealFFTPlan<>& real = SVL::real_fft_plan(n);
+
+    // Check a transform of the input against the DFT before timing
+    double error = 0.;
+    double naive = 0.;
+    if (n <= 4096) {
+      std::vector<cdbl> expected(n);
+      std::vector<flt> fre = re, fim = im;
+      plan.forward(fre.data(), fim.data());
+      naive = gflops(8. * dbl(n) * dbl(n), [&]() { dft(n, re.data(), im.data(), expected.data()); });
+      double rms = 0.;
+      for (i64 k = 0; k < n; ++k) {
+        error = SVL_MAX(error, std::abs(cdbl(fre[k], fim[k]) - expected[k]));
+        rms += std::norm(expected[k]);
+      }
+      error /= std::sqrt(rms / dbl(n));
+    }
+
+    double complex_rate = gflops(2. * flops, [&]() {
+      plan.forward(re.data(), im.data());
+      plan.inverse(re.data(), im.data());
+      SVL::scal(n, 1.f / flt(n), re.data());
+      SVL::scal(n, 1.f / flt(n), im.data());
+    });
+    double real_rate = gflops(flops / 2., [&]() { real.forward(x.data(), out_re.data(), out_im.data()); });
+
+    const i64 rows = SVL_MAX(i64(1), (i64(1) << 22) / n);
+    std::vector<flt> batch_re(rows * n), batch_im(rows * n);
+    for (flt& v : batch_re) v = dis(gen);
+    for (flt& v : batch_im) v = dis(gen);
+    double batched = gflops(2. * flops * dbl(rows), [&]() {
+      plan.forward(rows, batch_re.data(), batch_im.data(), n, threads);
+      plan.inverse(rows, batch_re.data(), batch_im.data(), n, threads);
+    });
+
+    if (n <= 4096)
+      printf("%10lld %10.2f %10.2f %10.2f %10.3f %12.3g\n", (long long)n, complex_rate, real_rate,
+             batched, naive, error);
+    else
+      printf("%10lld %10.2f %10.2f %10.2f %10s %12s\n", (long long)n, complex_rate, real_rate,
+             batched, "-", "-");
+  }
+  return 0;
+}
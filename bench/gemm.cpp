@@ -0,0 +1,68 @@
+// SVL::gemm and SVL::parallel_gemm on square matrices from 64 up to the size
+// given on the command line (default 2048), against a plain i, k, j loop that
+// the compiler is free to vectorise. Also times matmul<4, 4, 4>.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/gemm.cpp -o gemm -lpthread
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Best time in seconds over enough repeats to do at least 10^10 flops
+template <typename Run>
+static double time_run(double flops, Run run) {
+  i64 repeats = SVL_MAX(i64(3), SVL_MIN(i64(100000), i64(1e10 / flops)));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  i64 max_n = argc > 1 ? std::atoll(argv[1]) : 2048;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+
+  printf("GFLOP/s\n%8s %10s %10s %10s\n", "n", "loops", "gemm", "parallel");
+  for (i64 n = 64; n <= max_n; n *= 2) {
+    std::vector<flt> a(n * n), b(n * n), c(n * n);
+    for (flt& x : a) x = dis(gen);
+    for (flt& x : b) x = dis(gen);
+    const double flops = 2.0 * double(n) * double(n) * double(n);
+
+    double t_loops = time_run(flops, [&]() {
+      std::fill(c.begin(), c.end(), 0.f);
+      for (i64 i = 0; i < n; ++i)
+        for (i64 p = 0; p < n; ++p)
+          for (i64 j = 0; j < n; ++j) c[i * n + j] += a[i * n + p] * b[p * n + j];
+    });
+    double t_gemm = time_run(flops, [&]() {
+      SVL::gemm(n, n, n, 1.f, a.data(), n, b.data(), n, 0.f, c.data(), n);
+    });
+    double t_parallel = time_run(flops, [&]() {
+      SVL::parallel_gemm(n, n, n, 1.f, a.data(), n, b.data(), n, 0.f, c.data(), n);
+    });
+    printf("%8lld %10.1f %10.1f %10.1f\n", (long long)n, flops / t_loops * 1e-9,
+           flops / t_gemm * 1e-9, flops / t_parallel * 1e-9);
+  }
+
+  // Many small products, as in e.g. transforming points
+  const i64 count = 100000;
+  std::vector<flt> a(16 * count), b(16), c(16 * count);
+  for (flt& x : a) x = dis(gen);
+  for (flt& x : b) x = dis(gen);
+  double t_small = time_run(128.0 * count, [&]() {
+    for (i64 i = 0; i < count; ++i) SVL::matmul<4, 4, 4, SVL::Vec4f>(&c[16 * i], &a[16 * i], b.data());
+  });
+  printf("matmul<4, 4, 4>: %.1f ns each\n", t_small / double(count) * 1e9);
+  return 0;
+}
@@ -0,0 +1,103 @@
+// Throughput of the 64 bit integer vector operations against plain scalar
+// loops. Multiplication below AVX512, arithmetic right shift below AVX512,
+// min/max below AVX512 and unsigned compares are emulated with several
+// instructions, and this shows where that costs more than the scalar code.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -DSVL_USE_AVX2 -Iinclude bench/int64.cpp -o int64
+// and add -fno-tree-vectorize to keep the compiler from vectorizing the
+// scalar loops itself.
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static const i64 count = 1 << 14;
+static const int repeats = 2000;
+
+// Nanoseconds per element for running f over the arrays repeats times
+template <typename F>
+static double time_per_element(F f) {
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; ++r) f();
+  std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+  return t.count() / (double(repeats) * count);
+}
+
+template <typename T>
+struct Data {
+  std::vector<T> a, b, out;
+
+  Data() : a(count), b(count), out(count) {
+    std::mt19937_64 gen(42);
+    SVL_FOR_RANGE(count) {
+      a[i] = T(gen());
+      b[i] = T(gen());
+    }
+  }
+};
+
+// Runs op over the arrays in steps of V::step, or one element at a time for
+// scalar_t operations
+template <typename V, typename T, typename Op>
+static double bench(Data<T>& d, Op op) {
+  return time_per_element([&]() {
+    for (i64 i = 0; i < count; i += V::step)
+      op(V(&d.a[i]), V(&d.b[i])).store(&d.out[i]);
+  });
+}
+
+template <typename T, typename Op>
+static double bench_scalar(Data<T>& d, Op op) {
+  return time_per_element([&]() {
+    T* __restrict out = d.out.data();
+    const T* a = d.a.data();
+    const T* b = d.b.data();
+    for (i64 i = 0; i < count; ++i) out[i] = op(a[i], b[i]);
+  });
+}
+
+template <typename T, typename V2, typename V4, typename S, typename VOp>
+static void row(const char* name, Data<T>& d, S scalar_op, VOp vector_op) {
+  double s = bench_scalar(d, scalar_op);
+  double v2 = bench<V2>(d, vector_op);
+  double v4 = bench<V4>(d, vector_op);
+  printf("%-12s %10.3f %10.3f %10.3f %9.2fx %9.2fx\n", name, s, v2, v4, s / v2, s / v4);
+}
+
+int main() {
+#if SVL_USE_AVX2 || SVL_USE_AVX512
+  using I2 = SVL::sse::Vector2i64; using I4 = SVL::avx2::Vector4i64;
+  using U2 = SVL::sse::Vector2u64; using U4 = SVL::avx2::Vector4u64;
+#elif SVL_USE_SSE
+  using I2 = SVL::sse::Vector2i64; using I4 = SVL::sse::Vector4i64;
+  using U2 = SVL::sse::Vector2u64; using U4 = SVL::sse::Vector4u64;
+#else
+  using I2 = SVL::scalar::Vector2i64; using I4 = SVL::scalar::Vector4i64;
+  using U2 = SVL::scalar::Vector2u64; using U4 = SVL::scalar::Vector4u64;
+#endif
+  Data<i64> di;
+  Data<u64> du;
+
+  printf("ns per element, speedup over scalar > 1 means the vector code wins\n");
+  printf("%-12s %10s %10s %10s %10s %10s\n", "op", "scalar", "2 x 64", "4 x 64",
+         "x2 gain", "x4 gain");
+  row<i64, I2, I4>("add", di, [](i64 x, i64 y) { return i64(u64(x) + u64(y)); },
+                   [](auto x, auto y) { return x + y; });
+  row<i64, I2, I4>("mul", di, [](i64 x, i64 y) { return i64(u64(x) * u64(y)); },
+                   [](auto x, auto y) { return x * y; });
+  row<i64, I2, I4>("min i64", di, [](i64 x, i64 y) { return SVL_MIN(x, y); },
+                   [](auto x, auto y) { return min(x, y); });
+  row<u64, U2, U4>("min u64", du, [](u64 x, u64 y) { return SVL_MIN(x, y); },
+                   [](auto x, auto y) { return min(x, y); });
+  row<u64, U2, U4>("> u64", du, [](u64 x, u64 y) { return x > y ? ~u64(0) : 0; },
+                   [](auto x, auto y) { return x > y; });
+  row<i64, I2, I4>(">> i64", di, [](i64 x, i64) { return x >> 13; },
+                   [](auto x, auto) { return x >> 13; });
+  row<u64, U2, U4>(">> u64", du, [](u64 x, u64) { return x >> 13; },
+                   [](auto x, auto) { return x >> 13; });
+  return 0;
+}
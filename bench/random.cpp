@@ -0,0 +1,80 @@
+// Random float generation in GB/s of output, against std::mt19937 with the
+// standard uniform and normal distributions. Buffers of 2^12 floats stay in
+// cache and show the generators' own rate, and buffers of 2^24 are also
+// filled over all threads, each with a stream of its own.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/random.cpp -o random -pthread
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Best GB/s for run writing n floats, over enough repeats for at least 1e9
+template <typename Run>
+static double gbps(i64 n, Run run) {
+  i64 repeats = SVL_MAX(i64(3), i64(1e9 / dbl(n)));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  return dbl(n) * sizeof(flt) / best * 1e-9;
+}
+
+// Fill n floats at out over threads threads, each with its own stream
+template <typename V, typename Fill>
+static void parallel_fill(i64 n, flt* out, i64 threads, std::vector<SVL::Random<V>>& streams,
+                          Fill fill) {
+  const i64 per_thread = (n + threads - 1) / threads;
+  std::vector<std::thread> workers;
+  for (i64 t = 0; t < threads; ++t)
+    workers.emplace_back([&, t]() {
+      const i64 begin = SVL_MIN(t * per_thread, n);
+      fill(streams[t], SVL_MIN(per_thread, n - begin), out + begin);
+    });
+  for (std::thread& w : workers) w.join();
+}
+
+template <typename V>
+static void row(const char* name, i64 n, std::vector<flt>& out, i64 threads) {
+  SVL::Random<V> rng(1);
+  std::vector<SVL::Random<V>> streams;
+  for (i64 t = 0; t < threads; ++t) streams.emplace_back(1, t);
+  const i64 big = i64(out.size());
+  auto uniform = [](SVL::Random<V>& r, i64 m, flt* p) { r.fill_uniform(m, p); };
+  auto normal = [](SVL::Random<V>& r, i64 m, flt* p) { r.fill_normal(m, p); };
+  printf("%-12s %10.2f %10.2f %10.2f %10.2f\n", name,
+         gbps(n, [&]() { rng.fill_uniform(n, out.data()); }),
+         gbps(n, [&]() { rng.fill_normal(n, out.data()); }),
+         gbps(big, [&]() { parallel_fill<V>(big, out.data(), threads, streams, uniform); }),
+         gbps(big, [&]() { parallel_fill<V>(big, out.data(), threads, streams, normal); }));
+}
+
+int main() {
+  const i64 n = i64(1) << 12, big = i64(1) << 24;
+  const i64 threads = SVL_MAX(i64(1), i64(std::thread::hardware_concurrency()));
+  std::vector<flt> out(big);
+
+  printf("GB/s, %lld threads\n%-12s %10s %10s %10s %10s\n", (long long)threads, "", "uniform",
+         "normal", "uniform mt", "normal mt");
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> uniform(0.f, 1.f);
+  std::normal_distribution<flt> normal(0.f, 1.f);
+  printf("%-12s %10.2f %10.2f %10s %10s\n", "std::mt19937", gbps(n, [&]() {
+           for (i64 i = 0; i < n; ++i) out[i] = uniform(gen);
+         }),
+         gbps(n, [&]() {
+           for (i64 i = 0; i < n; ++i) out[i] = normal(gen);
+         }),
+         "-", "-");
+  row<SVL::Vec8f>("Vec8f", n, out, threads);
+  row<SVL::Vec16f>("Vec16f", n, out, threads);
+  return 0;
+}
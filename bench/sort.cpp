@@ -0,0 +1,68 @@
+// SVL::sort against std::sort on random floats, for keys alone and for keys
+// with a u32 payload (argsort), at sizes from 16 up to the one given on the
+// command line (default 10^8; 10^9 needs about 16 GB of memory).
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/sort.cpp -o sort
+
+#include <SVL/SVL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Best time in nanoseconds per element over enough repeats to sort at least
+// 10^7 elements in total. reset fills in new random input before each run, so
+// small sorts cannot train the branch predictor on one input
+template <typename Reset, typename Sort>
+static double time_sort(i64 n, Reset reset, Sort sort) {
+  i64 repeats = SVL_MAX(i64(1), SVL_MIN(i64(10000), i64(10000000) / n));
+  double best = 1e300;
+  for (i64 r = 0; r < repeats; ++r) {
+    reset();
+    auto start = std::chrono::steady_clock::now();
+    sort();
+    std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count() / double(n));
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  i64 max_n = argc > 1 ? std::atoll(argv[1]) : 100000000;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(-1e6f, 1e6f);
+
+  printf("ns per element, gain is std::sort time / SVL::sort time\n");
+  printf("%12s %10s %10s %7s %10s %10s %7s\n", "n", "std::sort", "SVL::sort",
+         "gain", "std kv", "SVL kv", "gain");
+  for (i64 n = 16; n <= max_n; n *= (n < 1024 ? 4 : 10)) {
+    std::vector<flt> input(n), keys(n);
+    std::vector<u32> values(n);
+    std::vector<std::pair<flt, u32>> pairs(n);
+
+    auto reset = [&]() {
+      for (flt& x : input) x = dis(gen);
+      std::copy(input.begin(), input.end(), keys.begin());
+    };
+    auto reset_kv = [&]() {
+      reset();
+      std::iota(values.begin(), values.end(), 0u);
+      SVL_FOR_RANGE(n) pairs[i] = { input[i], u32(i) };
+    };
+    double t_std = time_sort(n, reset, [&]() { std::sort(keys.begin(), keys.end()); });
+    double t_svl = time_sort(n, reset, [&]() { SVL::sort(keys.data(), n); });
+    double t_std_kv = time_sort(n, reset_kv, [&]() {
+      std::sort(pairs.begin(), pairs.end(),
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+    });
+    double t_svl_kv = time_sort(n, reset_kv, [&]() { SVL::sort(keys.data(), values.data(), n); });
+    printf("%12lld %10.2f %10.2f %6.2fx %10.2f %10.2f %6.2fx\n", (long long)n, t_std,
+           t_svl, t_std / t_svl, t_std_kv, t_svl_kv, t_std_kv / t_svl_kv);
+  }
+  return 0;
+}
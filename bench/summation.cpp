@@ -0,0 +1,68 @@
+// Accuracy against throughput of the float sums: a plain Vec8f accumulator,
+// SVL::pairwise_sum and SVL::compensated_sum, and SVL::dot against
+// SVL::compensated_dot, at sizes up to the one given on the command line
+// (default 10^8). The data are positive, so the errors are relative to sums
+// that don't cancel, and measured against a long double sum.
+//
+// Build with e.g.
+//   g++ -std=c++17 -O2 -mavx2 -mfma -mf16c -DSVL_USE_AVX2 -Iinclude bench/summation.cpp -o summation
+
+#include <SVL/SVL.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Best GB/s for run reading bytes over enough repeats to read at least 4 GB,
+// with the relative error of its result
+template <typename Run>
+static void measure(double bytes, long double exact, Run run) {
+  i64 repeats = SVL_MAX(i64(3), i64(4e9 / bytes));
+  double best = 1e300;
+  flt result = 0.f;
+  for (i64 r = 0; r < repeats; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    result = run();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    best = SVL_MIN(best, t.count());
+  }
+  double error = double(std::abs((result - exact) / exact));
+  printf(" %7.1f %8.1e", bytes / best * 1e-9, error);
+}
+
+int main(int argc, char** argv) {
+  i64 max_n = argc > 1 ? std::atoll(argv[1]) : 100000000;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<flt> dis(0.f, 1.f);
+
+  printf("GB/s and relative error\n%10s %16s %16s %16s %16s %16s\n", "n", "Vec8f sum",
+         "pairwise_sum", "compensated_sum", "dot", "compensated_dot");
+  for (i64 n = 1000; n <= max_n; n *= 10) {
+    std::vector<flt> x(n), y(n);
+    for (flt& v : x) v = dis(gen);
+    for (flt& v : y) v = dis(gen);
+    long double sum = 0, dot = 0;
+    SVL_FOR_RANGE(n) {
+      sum += x[i];
+      dot += (long double)x[i] * y[i];
+    }
+    const double bytes = double(n) * sizeof(flt);
+
+    printf("%10lld", (long long)n);
+    measure(bytes, sum, [&]() {
+      SVL::Vec8f acc = SVL::Vec8f::zeros();
+      i64 i = 0;
+      for (; i + 8 <= n; i += 8) acc += SVL::Vec8f(&x[i]);
+      return horizontal_add(acc + SVL::Vec8f().load_partial(&x[i], n - i));
+    });
+    measure(bytes, sum, [&]() { return SVL::pairwise_sum(n, x.data()); });
+    measure(bytes, sum, [&]() { return SVL::compensated_sum(n, x.data()); });
+    measure(2 * bytes, dot, [&]() { return SVL::dot(n, x.data(), y.data()); });
+    measure(2 * bytes, dot, [&]() { return SVL::compensated_dot(n, x.data(), y.data()); });
+    printf("\n");
+  }
+  return 0;
+}
@@ -31,10 +31,13 @@ using dbl = double;
 #define SVL_FOR_BEGIN_END(begin, end) for (i64 i = begin; i < end; ++i)
 //! Get the maximum of two values
 #define SVL_MAX(val1, val2) ((val1 > val2) ? val1 : val2)
-//! Get the minimum of two values
-#define SVL_MIN(val1, val2) ((val1 > val2) ? val2 : val1)
+//! Get the minimum of two values. Like minps, gives val2 if either is NaN
+#define SVL_MIN(val1, val2) ((val1 < val2) ? val1 : val2)
 //! Clamp a val between low and high
 #define SVL_CLAMP(low, val, high) SVL_MIN(SVL_MAX(low, val), high)
+//! Inline a function even where the compiler's size estimate would not, for
+//! kernels that should share their constant loads with the caller
+#define SVL_INLINE inline __attribute__((always_inline))
 
 //! Sets up the commoon header space for vector bool types
 #define VECTOR_BOOL_SETUP(type_name, sz, partial) \
@@ -57,12 +60,130 @@ using half_t = partial
 // Load the forward declarations
 #include "SVL_fwd.h"
 
-// Set the level of SIMD to use
+// Compile time vector constants
+namespace SVL {
+  //! Bit pattern of a float, usable in constant expressions
+  constexpr u32 float_bits(flt f) { return __builtin_bit_cast(u32, f); }
+
+  //! The 32 bit patterns Bits, repeated to fill a V if there are fewer, laid
+  //! out as a V in a 64 byte aligned static table
+  template <typename V, u32... Bits>
+  struct constant_table {
+    static_assert(sizeof(V) == V::step * sizeof(u32),
+                  "constant only supports vectors of 32 bit elements");
+    static_assert(V::step % sizeof...(Bits) == 0,
+                  "constant needs a pattern that repeats a whole number of times");
+    struct table_t { u32 values[V::step]; };
+    static constexpr table_t make() {
+      table_t t{};
+      const u32 bits[] = { Bits... };
+      for (u32 i = 0; i < V::step; ++i) t.values[i] = bits[i % sizeof...(Bits)];
+      return t;
+    }
+    alignas(64) static constexpr table_t table = make();
+  };
+
+  //! Vector with its elements set from the given bit patterns (fewer patterns
+  //! than elements are repeated), loaded from a static table rather than built
+  //! with set instructions on every call
+  template <typename V, u32... Bits>
+  inline V constant() {
+    const u32* values = constant_table<V, Bits...>::table.values;
+    // Only the address is hidden from the optimiser, so repeated loads of
+    // the same constant are still shared, but the value is never folded and
+    // rebuilt from immediates
+    asm("" : "+r"(values));
+    V r;
+    memcpy(&r, values, sizeof(V));
+    return r;
+  }
+}
+//! Vector of type V with every element equal to the float constant value
+#define SVL_CONSTANT(V, value) (SVL::constant<V, SVL::float_bits(value)>())
+
+// Compile time loop unrolling
+namespace SVL::detail {
+  //! f(integral_constant<i64, g>) for each g below G, unrolled so arrays
+  //! indexed by g can stay in registers
+  template <i64... G, typename F>
+  inline void unrolled(std::integer_sequence<i64, G...>, F f) {
+    (f(std::integral_constant<i64, G>()), ...);
+  }
+}
+
+// Polynomial evaluation on any of the vector types
+#include "polynomial.h"
+
+// Scalar conversions between float and the 16 bit storage formats
+namespace SVL {
+  //! Widen IEEE half precision bits to a float. NaNs are made quiet
+  inline flt f16_to_float(u16 h) {
+    u32 sign = u32(h & 0x8000) << 16, exp = (h >> 10) & 0x1f, mant = h & 0x3ff;
+    u32 bits;
+    if (exp == 0x1f) bits = sign | 0x7f800000 | (mant << 13) | (mant ? 0x400000 : 0);
+    else if (exp != 0) bits = sign | ((exp + 112) << 23) | (mant << 13);
+    else {
+      // Zero or denormal, exactly mant * 2^-24
+      flt f = flt(mant) * 5.9604644775390625e-8f;
+      memcpy(&bits, &f, sizeof(bits));
+      bits |= sign;
+    }
+    flt r;
+    memcpy(&r, &bits, sizeof(r));
+    return r;
+  }
+  //! Narrow a float to IEEE half precision bits, rounding to nearest even.
+  //! Values too large become infinity and NaNs are made quiet
+  inline u16 float_to_f16(flt f) {
+    u32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+    u16 sign = u16((bits >> 16) & 0x8000);
+    u32 a = bits & 0x7fffffff;
+    if (a > 0x7f800000) return u16(sign | 0x7e00 | ((a >> 13) & 0x3ff));
+    // 65520 and above round to infinity
+    if (a >= 0x477ff000) return u16(sign | 0x7c00);
+    if (a >= 0x38800000) {
+      // Normal, rebias the exponent then round off 13 bits of mantissa
+      a -= 112u << 23;
+      return u16(sign | ((a + 0xfff + ((a >> 13) & 1)) >> 13));
+    }
+    // Denormal or zero, adding 0.5 leaves the rounded mantissa in the low bits
+    flt x;
+    memcpy(&x, &a, sizeof(x));
+    x += 0.5f;
+    memcpy(&a, &x, sizeof(a));
+    return u16(sign | (a - 0x3f000000));
+  }
+  //! Widen bfloat16 bits to a float
+  inline flt bf16_to_float(u16 h) {
+    u32 bits = u32(h) << 16;
+    flt r;
+    memcpy(&r, &bits, sizeof(r));
+    return r;
+  }
+  //! Narrow a float to bfloat16 bits, rounding to nearest even. NaNs are
+  //! truncated and made quiet rather than rounded
+  inline u16 float_to_bf16(flt f) {
+    u32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+    if ((bits & 0x7fffffff) > 0x7f800000) return u16((bits >> 16) | 0x40);
+    return u16((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+  }
+}
+
+// Set the level of SIMD to use. SVL_SSE needs SSE4.2 (for the 64 bit integer
+// compares), SVL_AVX2 also FMA and F16C, and SVL_AVX512 the F, BW, DQ and VL
+// subsets
 #define SVL_NONE 0
 #define SVL_SSE 1
 #define SVL_AVX2 2
 #define SVL_AVX512 3
 
+// Define SVL_FAST_MATH to let the SIMD versions of vector / vector division
+// and sqrt use rcp_nr and rsqrt_nr instead of the full latency instructions.
+// Results are then within a few ULP rather than correctly rounded, and
+// dividing by zero or infinity gives NaN. sqrt(0) and sqrt(+inf) are still exact.
+
 // Include the scalar versions always
 namespace SVL::scalar {
 #define SVL_SIMD_LEVEL SVL_NONE
@@ -98,3 +219,50 @@ namespace SVL::avx2 {
 //}
 //#endif
 
+// Accuracy policies for the transcendental functions
+#include "math_policy.h"
+
+// Lazy expressions over arrays evaluated in a single fused loop
+#include "expression.h"
+
+// Whole buffer conversions to and from the 16 bit float formats
+#include "convert.h"
+
+// Prefix sums over arrays
+#include "scan.h"
+
+// Sorting arrays of floats
+#include "sort.h"
+
+// Positions of the extremes of arrays
+#include "minmax.h"
+
+// Histograms of arrays
+#include "histogram.h"
+
+// Matrix multiplication
+#include "gemm.h"
+
+// BLAS level 1 kernels
+#include "blas.h"
+
+// Compensated and pairwise summation
+#include "summation.h"
+
+// Interpolation in lookup tables
+#include "lut.h"
+
+// Complex numbers in split and interleaved layouts
+#include "complex.h"
+
+// Fast Fourier transforms
+#include "fft.h"
+
+// FIR filters and 2D convolution
+#include "convolution.h"
+
+// Biquad IIR filter cascades
+#include "biquad.h"
+
+// Random number generators
+#include "random.h"
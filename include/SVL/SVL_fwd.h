@@ -14,6 +14,18 @@ namespace SVL {
     struct Vector4d;
     struct Vector8d;
     struct Vector16d;
+    struct Vector16u8;
+    struct Vector32u8;
+    struct Vector64u8;
+    struct Vector8i16;
+    struct Vector16i16;
+    struct Vector32i16;
+    struct Vector2i64;
+    struct Vector4i64;
+    struct Vector8i64;
+    struct Vector2u64;
+    struct Vector4u64;
+    struct Vector8u64;
   }
   
 #if SVL_USE_SSE || SVL_USE_AVX2 || SVL_USE_AVX512
@@ -30,6 +42,18 @@ namespace SVL {
     struct Vector4d;
     struct Vector8d;
     struct Vector16d;
+    struct Vector16u8;
+    struct Vector32u8;
+    struct Vector64u8;
+    struct Vector8i16;
+    struct Vector16i16;
+    struct Vector32i16;
+    struct Vector2i64;
+    struct Vector4i64;
+    struct Vector8i64;
+    struct Vector2u64;
+    struct Vector4u64;
+    struct Vector8u64;
   }
 #endif
   
@@ -47,6 +71,18 @@ namespace SVL {
     struct Vector4d;
     struct Vector8d;
     struct Vector16d;
+    struct Vector16u8;
+    struct Vector32u8;
+    struct Vector64u8;
+    struct Vector8i16;
+    struct Vector16i16;
+    struct Vector32i16;
+    struct Vector2i64;
+    struct Vector4i64;
+    struct Vector8i64;
+    struct Vector2u64;
+    struct Vector4u64;
+    struct Vector8u64;
   }
 #endif
   
@@ -64,6 +100,18 @@ namespace SVL {
     struct Vector4d;
     struct Vector8d;
     struct Vector16d;
+    struct Vector16u8;
+    struct Vector32u8;
+    struct Vector64u8;
+    struct Vector8i16;
+    struct Vector16i16;
+    struct Vector32i16;
+    struct Vector2i64;
+    struct Vector4i64;
+    struct Vector8i64;
+    struct Vector2u64;
+    struct Vector4u64;
+    struct Vector8u64;
   }
 #endif
   
@@ -75,6 +123,18 @@ namespace SVL {
   using Vec4b  = avx512::Vector4b;
   using Vec8b  = avx512::Vector8b;
   using Vec16b = avx512::Vector16b;
+  using Vec16u8  = avx512::Vector16u8;
+  using Vec32u8  = avx512::Vector32u8;
+  using Vec64u8  = avx512::Vector64u8;
+  using Vec8i16  = avx512::Vector8i16;
+  using Vec16i16 = avx512::Vector16i16;
+  using Vec32i16 = avx512::Vector32i16;
+  using Vec2i64  = avx512::Vector2i64;
+  using Vec4i64  = avx512::Vector4i64;
+  using Vec8i64  = avx512::Vector8i64;
+  using Vec2u64  = avx512::Vector2u64;
+  using Vec4u64  = avx512::Vector4u64;
+  using Vec8u64  = avx512::Vector8u64;
 #elif SVL_USE_AVX2
   using Vec4f  = avx2::Vector4f;
   using Vec8f  = avx2::Vector8f;
@@ -82,6 +142,18 @@ namespace SVL {
   using Vec4b  = avx2::Vector4b;
   using Vec8b  = avx2::Vector8b;
   using Vec16b = avx2::Vector16b;
+  using Vec16u8  = avx2::Vector16u8;
+  using Vec32u8  = avx2::Vector32u8;
+  using Vec64u8  = avx2::Vector64u8;
+  using Vec8i16  = avx2::Vector8i16;
+  using Vec16i16 = avx2::Vector16i16;
+  using Vec32i16 = avx2::Vector32i16;
+  using Vec2i64  = avx2::Vector2i64;
+  using Vec4i64  = avx2::Vector4i64;
+  using Vec8i64  = avx2::Vector8i64;
+  using Vec2u64  = avx2::Vector2u64;
+  using Vec4u64  = avx2::Vector4u64;
+  using Vec8u64  = avx2::Vector8u64;
 #elif SVL_USE_SSE
   using Vec4f  = sse::Vector4f;
   using Vec8f  = sse::Vector8f;
@@ -89,6 +161,18 @@ namespace SVL {
   using Vec4b  = sse::Vector4b;
   using Vec8b  = sse::Vector8b;
   using Vec16b = sse::Vector16b;
+  using Vec16u8  = sse::Vector16u8;
+  using Vec32u8  = sse::Vector32u8;
+  using Vec64u8  = sse::Vector64u8;
+  using Vec8i16  = sse::Vector8i16;
+  using Vec16i16 = sse::Vector16i16;
+  using Vec32i16 = sse::Vector32i16;
+  using Vec2i64  = sse::Vector2i64;
+  using Vec4i64  = sse::Vector4i64;
+  using Vec8i64  = sse::Vector8i64;
+  using Vec2u64  = sse::Vector2u64;
+  using Vec4u64  = sse::Vector4u64;
+  using Vec8u64  = sse::Vector8u64;
 #else
   using Vec4f  = scalar::Vector4f;
   using Vec8f  = scalar::Vector8f;
@@ -96,6 +180,18 @@ namespace SVL {
   using Vec4b  = scalar::Vector4b;
   using Vec8b  = scalar::Vector8b;
   using Vec16b = scalar::Vector16b;
+  using Vec16u8  = scalar::Vector16u8;
+  using Vec32u8  = scalar::Vector32u8;
+  using Vec64u8  = scalar::Vector64u8;
+  using Vec8i16  = scalar::Vector8i16;
+  using Vec16i16 = scalar::Vector16i16;
+  using Vec32i16 = scalar::Vector32i16;
+  using Vec2i64  = scalar::Vector2i64;
+  using Vec4i64  = scalar::Vector4i64;
+  using Vec8i64  = scalar::Vector8i64;
+  using Vec2u64  = scalar::Vector2u64;
+  using Vec4u64  = scalar::Vector4u64;
+  using Vec8u64  = scalar::Vector8u64;
 #endif
   
 }
@@ -0,0 +1,215 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Cascades of biquad IIR filters in transposed direct form II,
+//   y = b0 x + s1,  s1 = b1 x - a1 y + s2,  s2 = b2 x - a2 y
+// The recursion runs one sample at a time, so BiquadBank vectorises across
+// channels instead: each lane is an independent filter, and several
+// registers of channels are stepped together to hide the latency of the
+// recursion. BlockBiquad filters a single channel V::step samples at a time
+// by writing each block's outputs as a matrix of its inputs plus the two
+// states coming in, and the states going out from its last two samples.
+//
+// Both work section by section over chunks of biquad_chunk samples, so the
+// state of a section stays in registers while the chunk stays in cache.
+
+namespace SVL {
+  //! Coefficients of a biquad section with transfer function
+  //! (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+  struct BiquadCoefficients {
+    flt b0 = 1.f, b1 = 0.f, b2 = 0.f, a1 = 0.f, a2 = 0.f;
+  };
+
+  namespace detail {
+    //! Samples filtered by each section before moving on to the next
+    static const i64 biquad_chunk = 128;
+  }
+
+  //! Cascades of biquad sections filtering channels channels together, one
+  //! channel per lane. Samples are interleaved by time, sample t of channel
+  //! c at x[t * channels + c], and filtered in place. State carries over
+  //! from one call of process to the next
+  template <typename V = Vec8f>
+  struct BiquadBank {
+    i64 channels, sections, groups;
+    //! For each group of V::step channels and each section, b0 b1 b2 -a1
+    //! -a2 a register each
+    std::vector<flt> coefficients;
+    //! For each group and section, s1 and s2 a register each
+    std::vector<flt> state;
+
+    BiquadBank(i64 channels, i64 sections)
+        : channels(channels), sections(sections), groups((channels + V::step - 1) / V::step),
+          coefficients(groups * sections * 5 * V::step, 0.f),
+          state(groups * sections * 2 * V::step, 0.f) {
+      for (i64 c = 0; c < groups * V::step; ++c)
+        for (i64 s = 0; s < sections; ++s) set(c, s, BiquadCoefficients());
+    }
+
+    //! Set section of channel to coeffs
+    void set(i64 channel, i64 section, const BiquadCoefficients& coeffs) {
+      flt* c = coefficients.data() + ((channel / V::step) * sections + section) * 5 * V::step +
+               channel % V::step;
+      c[0] = coeffs.b0;
+      c[V::step] = coeffs.b1;
+      c[2 * V::step] = coeffs.b2;
+      c[3 * V::step] = -coeffs.a1;
+      c[4 * V::step] = -coeffs.a2;
+    }
+    //! Set section of every channel to coeffs
+    void set(i64 section, const BiquadCoefficients& coeffs) {
+      for (i64 c = 0; c < channels; ++c) set(c, section, coeffs);
+    }
+    //! Zero the state of every filter
+    void reset() { std::fill(state.begin(), state.end(), 0.f); }
+
+    //! Filter n samples of every channel at x in place
+    void process(i64 n, flt* x) {
+      for (i64 t = 0; t < n; t += detail::biquad_chunk) {
+        const i64 m = SVL_MIN(detail::biquad_chunk, n - t);
+        flt* chunk = x + t * channels;
+        // Four full groups at a time where possible, for four independent
+        // recursions in flight
+        i64 g = 0;
+        const i64 full = channels / V::step;
+        for (; g + 4 <= full; g += 4) run<4>(m, chunk, g, V::step);
+        if (full - g == 3) run<3>(m, chunk, g, V::step);
+        else if (full - g == 2) run<2>(m, chunk, g, V::step);
+        else if (full - g == 1) run<1>(m, chunk, g, V::step);
+        if (full < groups) run<1>(m, chunk, full, channels - full * V::step);
+      }
+    }
+
+   private:
+    //! Filter n samples of the G groups from g0, with lanes channels in each
+    template <i64 G>
+    void run(i64 n, flt* x, i64 g0, i64 lanes) {
+      const auto each = std::make_integer_sequence<i64, G>();
+      for (i64 s = 0; s < sections; ++s) {
+        V b0[G], b1[G], b2[G], na1[G], na2[G], s1[G], s2[G];
+        detail::unrolled(each, [&](auto g) {
+          const flt* c = coefficients.data() + ((g0 + g) * sections + s) * 5 * V::step;
+          b0[g] = V(c);
+          b1[g] = V(c + V::step);
+          b2[g] = V(c + 2 * V::step);
+          na1[g] = V(c + 3 * V::step);
+          na2[g] = V(c + 4 * V::step);
+          const flt* st = state.data() + ((g0 + g) * sections + s) * 2 * V::step;
+          s1[g] = V(st);
+          s2[g] = V(st + V::step);
+        });
+        for (i64 t = 0; t < n; ++t) {
+          flt* frame = x + t * channels + g0 * V::step;
+          detail::unrolled(each, [&](auto g) {
+            flt* p = frame + g * V::step;
+            const V in = lanes == V::step ? V(p) : V().load_partial(p, lanes);
+            const V y = fma(b0[g], in, s1[g]);
+            s1[g] = fma(na1[g], y, fma(b1[g], in, s2[g]));
+            s2[g] = fma(na2[g], y, b2[g] * in);
+            if (lanes == V::step) y.store(p);
+            else y.store_partial(p, lanes);
+          });
+        }
+        detail::unrolled(each, [&](auto g) {
+          flt* st = state.data() + ((g0 + g) * sections + s) * 2 * V::step;
+          s1[g].store(st);
+          s2[g].store(st + V::step);
+        });
+      }
+    }
+  };
+
+  //! A cascade of biquad sections filtering one channel in place, V::step
+  //! samples at a time. State carries over from one call of process to the
+  //! next
+  template <typename V = Vec8f>
+  struct BlockBiquad {
+    static const i64 block = V::step;
+
+    struct section {
+      BiquadCoefficients coeffs;
+      //! The block's outputs due to input k, whose lanes hold the impulse
+      //! response from lane k on
+      V inputs[V::step];
+      //! The block's outputs due to s1 and s2 of 1 coming in
+      V from_s1, from_s2;
+      flt s1 = 0.f, s2 = 0.f;
+    };
+    std::vector<section> sections;
+
+    BlockBiquad(const BiquadCoefficients* coeffs, i64 count) : sections(count) {
+      for (i64 s = 0; s < count; ++s) {
+        section& sec = sections[s];
+        sec.coeffs = coeffs[s];
+        // Run the recursion in double precision from each unit input or state
+        auto response = [&](i64 impulse_at, dbl s1, dbl s2) {
+          const BiquadCoefficients& c = sec.coeffs;
+          flt out[V::step];
+          for (i64 t = 0; t < block; ++t) {
+            const dbl in = t == impulse_at ? 1. : 0.;
+            const dbl y = c.b0 * in + s1;
+            s1 = c.b1 * in - c.a1 * y + s2;
+            s2 = c.b2 * in - c.a2 * y;
+            out[t] = flt(y);
+          }
+          return V(out);
+        };
+        for (i64 k = 0; k < block; ++k) sec.inputs[k] = response(k, 0., 0.);
+        sec.from_s1 = response(-1, 1., 0.);
+        sec.from_s2 = response(-1, 0., 1.);
+      }
+    }
+    explicit BlockBiquad(const std::vector<BiquadCoefficients>& coeffs)
+        : BlockBiquad(coeffs.data(), i64(coeffs.size())) { }
+
+    //! Zero the state of every section
+    void reset() {
+      for (section& sec : sections) sec.s1 = sec.s2 = 0.f;
+    }
+
+    //! Filter the n samples at x in place
+    void process(i64 n, flt* x) {
+      for (i64 t = 0; t < n; t += detail::biquad_chunk) {
+        const i64 m = SVL_MIN(detail::biquad_chunk, n - t);
+        for (section& sec : sections) run(sec, m, x + t);
+      }
+    }
+
+   private:
+    void run(section& sec, i64 n, flt* x) {
+      const BiquadCoefficients& c = sec.coeffs;
+      flt s1 = sec.s1, s2 = sec.s2;
+      i64 t = 0;
+      for (; t + block <= n; t += block) {
+        flt* p = x + t;
+        // The inputs' part doesn't depend on the state, so only the last
+        // two multiply adds wait for the block before
+        V even = V::zeros(), odd = V::zeros();
+        for (i64 k = 0; k < block; k += 2) {
+          even = fma(V(p[k]), sec.inputs[k], even);
+          odd = fma(V(p[k + 1]), sec.inputs[k + 1], odd);
+        }
+        const V y = fma(V(s1), sec.from_s1, fma(V(s2), sec.from_s2, even + odd));
+        const flt x1 = p[block - 1], x2 = p[block - 2];
+        y.store(p);
+        const flt y1 = p[block - 1], y2 = p[block - 2];
+        // The states after the last two samples
+        s1 = c.b1 * x1 - c.a1 * y1 + c.b2 * x2 - c.a2 * y2;
+        s2 = c.b2 * x1 - c.a2 * y1;
+      }
+      for (; t < n; ++t) {
+        const flt in = x[t], y = c.b0 * in + s1;
+        s1 = c.b1 * in - c.a1 * y + s2;
+        s2 = c.b2 * in - c.a2 * y;
+        x[t] = y;
+      }
+      sec.s1 = s1;
+      sec.s2 = s2;
+    }
+  };
+}
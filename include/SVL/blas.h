@@ -0,0 +1,187 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <limits>
+
+// BLAS level 1 kernels over arrays of floats. Reductions keep four
+// independent accumulators, so the adds of one don't wait on the last.
+// Element i of a strided array x is x[i * incx]. Strided elements are
+// gathered into registers, contiguous ones loaded directly.
+
+namespace SVL {
+  namespace detail {
+    //! m elements from p (stride inc when strided) in a V, zero padded
+    template <typename V, bool strided>
+    inline V load_elements(const flt* p, i64 inc, i64 m) {
+      if constexpr (strided) {
+        flt buffer[V::step] = {};
+        for (i64 l = 0; l < m; ++l) buffer[l] = p[l * inc];
+        return V(buffer);
+      } else return m == V::step ? V(p) : V().load_partial(p, m);
+    }
+    //! Store the first m elements of x to p (stride inc when strided)
+    template <typename V, bool strided>
+    inline void store_elements(const V& x, flt* p, i64 inc, i64 m) {
+      if constexpr (strided) {
+        flt buffer[V::step];
+        x.store(buffer);
+        for (i64 l = 0; l < m; ++l) p[l * inc] = buffer[l];
+      } else if (m == V::step) x.store(p);
+      else x.store_partial(p, m);
+    }
+
+    //! Fold the n elements through step(acc, i, m), which adds the m
+    //! elements from i to acc, over four accumulators merged with combine
+    template <typename V, typename Step, typename Combine>
+    inline V accumulate(i64 n, Step step, Combine combine) {
+      V a0 = V::zeros(), a1 = a0, a2 = a0, a3 = a0;
+      i64 i = 0;
+      for (; i + 4 * V::step <= n; i += 4 * V::step) {
+        a0 = step(a0, i, V::step);
+        a1 = step(a1, i + V::step, V::step);
+        a2 = step(a2, i + 2 * V::step, V::step);
+        a3 = step(a3, i + 3 * V::step, V::step);
+      }
+      for (; i + V::step <= n; i += V::step) a0 = step(a0, i, V::step);
+      if (i < n) a1 = step(a1, i, n - i);
+      return combine(combine(a0, a1), combine(a2, a3));
+    }
+    //! Sum of vectors, for accumulate
+    struct add {
+      template <typename V>
+      V operator()(const V& a, const V& b) const { return a + b; }
+    };
+    //! Absolute value of a flt or a V
+    struct absolute {
+      flt operator()(flt x) const { return std::abs(x); }
+      template <typename V>
+      V operator()(const V& x) const { return abs(x); }
+    };
+
+    template <typename V, bool strided>
+    inline flt dot(i64 n, const flt* x, i64 incx, const flt* y, i64 incy) {
+      return horizontal_add(accumulate<V>(n, [&](const V& acc, i64 i, i64 m) {
+        return fma(load_elements<V, strided>(x + i * incx, incx, m),
+                   load_elements<V, strided>(y + i * incy, incy, m), acc);
+      }, add()));
+    }
+    template <typename V, bool strided>
+    inline void axpy(i64 n, flt alpha, const flt* x, i64 incx, flt* y, i64 incy) {
+      const V a(alpha);
+      for (i64 i = 0; i < n; i += V::step) {
+        const i64 m = SVL_MIN(i64(V::step), n - i);
+        V r = fma(a, load_elements<V, strided>(x + i * incx, incx, m),
+                  load_elements<V, strided>(y + i * incy, incy, m));
+        store_elements<V, strided>(r, y + i * incy, incy, m);
+      }
+    }
+    template <typename V, bool strided>
+    inline void scal(i64 n, flt alpha, flt* x, i64 incx) {
+      const V a(alpha);
+      for (i64 i = 0; i < n; i += V::step) {
+        const i64 m = SVL_MIN(i64(V::step), n - i);
+        store_elements<V, strided>(a * load_elements<V, strided>(x + i * incx, incx, m),
+                                   x + i * incx, incx, m);
+      }
+    }
+    template <typename V, bool strided>
+    inline flt asum(i64 n, const flt* x, i64 incx) {
+      return horizontal_add(accumulate<V>(n, [&](const V& acc, i64 i, i64 m) {
+        return acc + abs(load_elements<V, strided>(x + i * incx, incx, m));
+      }, add()));
+    }
+    template <typename V, bool strided>
+    inline flt nrm2(i64 n, const flt* x, i64 incx) {
+      flt sum = horizontal_add(accumulate<V>(n, [&](const V& acc, i64 i, i64 m) {
+        V xi = load_elements<V, strided>(x + i * incx, incx, m);
+        return fma(xi, xi, acc);
+      }, add()));
+      // Squares below 2^-126 lose precision, but can't matter next to a sum
+      // of at least 2^-70
+      if (sum != sum || (sum >= 0x1p-70f && sum < std::numeric_limits<flt>::infinity()))
+        return std::sqrt(sum);
+      // The squares overflowed or underflowed, so scale by the largest value
+      flt largest = horizontal_max(accumulate<V>(n, [&](const V& acc, i64 i, i64 m) {
+        return max(acc, abs(load_elements<V, strided>(x + i * incx, incx, m)));
+      }, [](const V& a, const V& b) { return max(a, b); }));
+      if (largest == 0.f || largest == std::numeric_limits<flt>::infinity()) return largest;
+      const V scale(largest);
+      sum = horizontal_add(accumulate<V>(n, [&](const V& acc, i64 i, i64 m) {
+        V xi = load_elements<V, strided>(x + i * incx, incx, m) / scale;
+        return fma(xi, xi, acc);
+      }, add()));
+      return largest * std::sqrt(sum);
+    }
+  }
+
+  //! Sum of x[i] * y[i] over the n elements
+  template <typename V = Vec8f>
+  inline flt dot(i64 n, const flt* x, const flt* y) {
+    return detail::dot<V, false>(n, x, 1, y, 1);
+  }
+  //! Sum of x[i * incx] * y[i * incy] over the n elements
+  template <typename V = Vec8f>
+  inline flt dot(i64 n, const flt* x, i64 incx, const flt* y, i64 incy) {
+    if (incx == 1 && incy == 1) return detail::dot<V, false>(n, x, 1, y, 1);
+    return detail::dot<V, true>(n, x, incx, y, incy);
+  }
+
+  //! y = alpha * x + y over the n elements
+  template <typename V = Vec8f>
+  inline void axpy(i64 n, flt alpha, const flt* x, flt* y) {
+    detail::axpy<V, false>(n, alpha, x, 1, y, 1);
+  }
+  //! y = alpha * x + y over n elements with strides incx and incy
+  template <typename V = Vec8f>
+  inline void axpy(i64 n, flt alpha, const flt* x, i64 incx, flt* y, i64 incy) {
+    if (incx == 1 && incy == 1) detail::axpy<V, false>(n, alpha, x, 1, y, 1);
+    else detail::axpy<V, true>(n, alpha, x, incx, y, incy);
+  }
+
+  //! x = alpha * x over the n elements
+  template <typename V = Vec8f>
+  inline void scal(i64 n, flt alpha, flt* x) {
+    detail::scal<V, false>(n, alpha, x, 1);
+  }
+  //! x = alpha * x over n elements with stride incx
+  template <typename V = Vec8f>
+  inline void scal(i64 n, flt alpha, flt* x, i64 incx) {
+    if (incx == 1) detail::scal<V, false>(n, alpha, x, 1);
+    else detail::scal<V, true>(n, alpha, x, incx);
+  }
+
+  //! Euclidean norm of the n elements, without overflow or underflow in the
+  //! squares
+  template <typename V = Vec8f>
+  inline flt nrm2(i64 n, const flt* x, i64 incx = 1) {
+    if (incx == 1) return detail::nrm2<V, false>(n, x, 1);
+    return detail::nrm2<V, true>(n, x, incx);
+  }
+
+  //! Sum of the absolute values of the n elements
+  template <typename V = Vec8f>
+  inline flt asum(i64 n, const flt* x, i64 incx = 1) {
+    if (incx == 1) return detail::asum<V, false>(n, x, 1);
+    return detail::asum<V, true>(n, x, incx);
+  }
+
+  //! Index of the first element with the largest absolute value, skipping
+  //! NaNs, or -1 if there is none. Counts from 0, unlike Fortran BLAS
+  template <typename V = Vec8f>
+  inline i64 iamax(i64 n, const flt* x, i64 incx = 1) {
+    if (incx == 1)
+      return detail::find_extremes<V, false, true>(x, 0, n, nan_policy::ignore,
+                                                   detail::absolute()).second.index;
+    i64 best = -1;
+    flt largest = 0.f;
+    for (i64 i = 0; i < n; ++i) {
+      flt a = std::abs(x[i * incx]);
+      if (a == a && (best < 0 || a > largest)) {
+        best = i;
+        largest = a;
+      }
+    }
+    return best;
+  }
+}
@@ -195,7 +195,7 @@ struct Vector4b {
   //! Bitwise ANDNOT of two vectors
   friend inline self_t and_not(const self_t& a, const self_t& b) {
 #if SVL_SIMD_LEVEL < SVL_SSE
-    self_t r = a & ~b;
+    self_t r = ~a & b;
 #else
     self_t r = _mm_andnot_si128(a, b);
 #endif
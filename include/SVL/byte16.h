@@ -0,0 +1,361 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+struct Vector16u8 {
+  // Comparisons give masks with all bits of a lane set rather than a bool type
+  VECTOR_NUMBER_SETUP(Vector16u8, 16, Vector16u8, u8, std::nullptr_t);
+
+#if SVL_SIMD_LEVEL < SVL_SSE
+  using intrinsic_t = struct { scalar_t v[16]; };
+#else
+  // Intrinsic type will always be _m128i with simd
+  using intrinsic_t = __m128i;
+#endif
+  intrinsic_t data;
+
+  static self_t zeros() {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    memset(&r.data, 0, sizeof(r.data));
+    return r;
+#else
+    return _mm_setzero_si128();
+#endif
+  }
+
+  // Constructors
+  //! Default constructor
+  Vector16u8() = default;
+  //! Copy constructor
+  Vector16u8(const self_t&) = default;
+  //! Move constructor
+  Vector16u8(self_t&&) = default;
+  //! Copy assignment
+  self_t& operator=(const self_t&) = default;
+  //! Move assignment
+  self_t& operator=(self_t&&) = default;
+  //! Destructor
+  ~Vector16u8() = default;
+
+  //! Construct from an array
+  Vector16u8(const scalar_t* arr) { load(arr); }
+  //! Broadcast a value to all elements
+  Vector16u8(scalar_t v) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    memset(data.v, v, sizeof(data.v));
+#else
+    data = _mm_set1_epi8(char(v));
+#endif
+  }
+  //! Convert from intrinsic type
+  Vector16u8(const intrinsic_t& v) : data(v) { }
+  //! Covert to intrinsic type
+  operator intrinsic_t() const { return data; }
+  //! Assign from intrinsic type
+  self_t& operator=(const intrinsic_t& v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Assign from scalar type
+  self_t& operator=(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+
+  // Load/save data
+  //! Load values from an array
+  self_t& load(const scalar_t* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    memcpy(data.v, arr, sizeof(data.v));
+#else
+    data = _mm_loadu_si128((const __m128i*)arr);
+#endif
+    return *this;
+  }
+  //! Load n values from an array. Rest of data will be set to 0
+  self_t& load_partial(const scalar_t* arr, i64 n) {
+    n = SVL_CLAMP(0, n, step);
+    scalar_t tmp[step] = { };
+    memcpy(tmp, arr, n * sizeof(scalar_t));
+    return load(tmp);
+  }
+  //! Load and broadcast a value to all elements
+  self_t& broadcast(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Store values in an array
+  void store(scalar_t* arr) const {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    memcpy(arr, data.v, sizeof(data.v));
+#else
+    _mm_storeu_si128((__m128i*)arr, data);
+#endif
+  }
+  //! Store n values in an array
+  void store_partial(scalar_t* arr, i64 n) const {
+    n = SVL_CLAMP(0, n, step);
+    scalar_t tmp[step];
+    store(tmp);
+    memcpy(arr, tmp, n * sizeof(scalar_t));
+  }
+
+  // Access single value
+  //! RO access to a single value
+  scalar_t access(i64 idx) const {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    return tmp[idx];
+  }
+  //! RO access to a single value
+  scalar_t operator[](i64 idx) const { return access(idx); }
+  //! Assign a single value
+  self_t& assign(scalar_t v, i64 idx) {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    tmp[idx] = v;
+    return load(tmp);
+  }
+
+  // Arithmetic operators, wrapping on overflow
+  //! Addition of two vectors
+  friend inline self_t operator+(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(a.data.v[i] + b.data.v[i]);
+    return r;
+#else
+    return _mm_add_epi8(a, b);
+#endif
+  }
+  //! Inplace addition of two vectors
+  friend inline self_t& operator+=(self_t& a, const self_t& b) {
+    a = a + b;
+    return a;
+  }
+  //! Subtraction of two vectors
+  friend inline self_t operator-(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(a.data.v[i] - b.data.v[i]);
+    return r;
+#else
+    return _mm_sub_epi8(a, b);
+#endif
+  }
+  //! Inplace subtraction of two vectors
+  friend inline self_t& operator-=(self_t& a, const self_t& b) {
+    a = a - b;
+    return a;
+  }
+
+  // Comparison operators
+  //! Returns a mask of all elements where a == b
+  friend inline self_t operator==(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] == b.data.v[i] ? 0xFF : 0;
+    return r;
+#else
+    return _mm_cmpeq_epi8(a, b);
+#endif
+  }
+  //! Returns a mask of all elements where a != b
+  friend inline self_t operator!=(const self_t& a, const self_t& b) {
+    return ~(a == b);
+  }
+  //! Returns a mask of all elements where a >= b
+  friend inline self_t operator>=(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] >= b.data.v[i] ? 0xFF : 0;
+    return r;
+#else
+    // There is no unsigned compare, but max(a, b) == a exactly when a >= b
+    return _mm_cmpeq_epi8(_mm_max_epu8(a, b), a);
+#endif
+  }
+  //! Returns a mask of all elements where a <= b
+  friend inline self_t operator<=(const self_t& a, const self_t& b) {
+    return b >= a;
+  }
+  //! Returns a mask of all elements where a > b
+  friend inline self_t operator>(const self_t& a, const self_t& b) {
+    return ~(b >= a);
+  }
+  //! Returns a mask of all elements where a < b
+  friend inline self_t operator<(const self_t& a, const self_t& b) {
+    return ~(a >= b);
+  }
+
+  // Logical operators
+  //! Bitwise AND of two vectors
+  friend inline self_t operator&(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] & b.data.v[i];
+    return r;
+#else
+    return _mm_and_si128(a, b);
+#endif
+  }
+  //! Bitwise OR of two vectors
+  friend inline self_t operator|(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] | b.data.v[i];
+    return r;
+#else
+    return _mm_or_si128(a, b);
+#endif
+  }
+  //! Bitwise XOR of two vectors
+  friend inline self_t operator^(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] ^ b.data.v[i];
+    return r;
+#else
+    return _mm_xor_si128(a, b);
+#endif
+  }
+  //! Bitwise NOT of a vector
+  friend inline self_t operator~(const self_t& a) {
+    return a ^ self_t(0xFF);
+  }
+  //! Bitwise ANDNOT of two vectors, ~a & b
+  friend inline self_t and_not(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return ~a & b;
+#else
+    return _mm_andnot_si128(a, b);
+#endif
+  }
+
+  // Shifts
+  //! Shift all elements of a left by n bits
+  friend inline self_t operator<<(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = n < 8 ? scalar_t(a.data.v[i] << n) : 0;
+    return r;
+#else
+    // Shift as 16 bit elements and clear the bits shifted in from the neighbour
+    __m128i r = _mm_sll_epi16(a, _mm_cvtsi32_si128(n));
+    return _mm_and_si128(r, _mm_set1_epi8(char(n < 8 ? 0xFF << n : 0)));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in zeros
+  friend inline self_t operator>>(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = n < 8 ? scalar_t(a.data.v[i] >> n) : 0;
+    return r;
+#else
+    __m128i r = _mm_srl_epi16(a, _mm_cvtsi32_si128(n));
+    return _mm_and_si128(r, _mm_set1_epi8(char(n < 8 ? 0xFF >> n : 0)));
+#endif
+  }
+
+  // General functions
+  //! Blend two vectors, taking elements from a where mask is set
+  friend inline self_t blend(const self_t& a, const self_t& b, const self_t& mask) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return (a & mask) | and_not(mask, b);
+#else
+    return _mm_blendv_epi8(b, a, mask);
+#endif
+  }
+  //! Elementwise maximum of a and b
+  friend inline self_t max(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = SVL_MAX(a.data.v[i], b.data.v[i]);
+    return r;
+#else
+    return _mm_max_epu8(a, b);
+#endif
+  }
+  //! Elementwise minimum of a and b
+  friend inline self_t min(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = SVL_MIN(a.data.v[i], b.data.v[i]);
+    return r;
+#else
+    return _mm_min_epu8(a, b);
+#endif
+  }
+  //! Addition of two vectors, saturating at 255
+  friend inline self_t add_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(SVL_MIN(a.data.v[i] + b.data.v[i], 255));
+    return r;
+#else
+    return _mm_adds_epu8(a, b);
+#endif
+  }
+  //! Subtraction of two vectors, saturating at 0
+  friend inline self_t sub_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(SVL_MAX(a.data.v[i] - b.data.v[i], 0));
+    return r;
+#else
+    return _mm_subs_epu8(a, b);
+#endif
+  }
+  //! Average of a and b rounded up, (a + b + 1) >> 1 without overflow
+  friend inline self_t avg(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t((a.data.v[i] + b.data.v[i] + 1) >> 1);
+    return r;
+#else
+    return _mm_avg_epu8(a, b);
+#endif
+  }
+  //! High 8 bits of the 16 bit products of a and b
+  friend inline self_t mulhi(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t((a.data.v[i] * b.data.v[i]) >> 8);
+    return r;
+#else
+    // Multiply the even and odd bytes as 16 bit elements
+    __m128i even = _mm_mullo_epi16(_mm_and_si128(a, _mm_set1_epi16(0xFF)),
+                                   _mm_and_si128(b, _mm_set1_epi16(0xFF)));
+    __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+    return _mm_or_si128(_mm_srli_epi16(even, 8),
+                        _mm_and_si128(odd, _mm_set1_epi16(i16(0xFF00))));
+#endif
+  }
+  //! Multiply the unsigned elements of a with the signed elements of b and add
+  //! neighbouring pairs of products, saturating to 16 bits
+  friend inline Vector8i16 maddubs(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    i16 r[Vector8i16::step];
+    SVL_FOR_RANGE(Vector8i16::step) {
+      i32 sum = a.data.v[2 * i] * i8(b.data.v[2 * i]) +
+                a.data.v[2 * i + 1] * i8(b.data.v[2 * i + 1]);
+      r[i] = i16(SVL_CLAMP(-32768, sum, 32767));
+    }
+    return Vector8i16(r);
+#else
+    return _mm_maddubs_epi16(a, b);
+#endif
+  }
+};
+
+#ifdef DEBUG
+static inline std::ostream& operator<<(std::ostream& os, const Vector16u8& v) {
+  os << "<";
+  SVL_FOR_RANGE(v.step) os << i32(v[i]) << ((i < (v.step - 1)) ? ", " : "");
+  os << ">";
+  return os;
+}
+#endif
@@ -0,0 +1,354 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+struct Vector64u8 {
+  // Comparisons give masks with all bits of a lane set rather than a bool type
+  VECTOR_NUMBER_SETUP(Vector64u8, 64, Vector64u8, u8, Vector32u8);
+
+#if SVL_SIMD_LEVEL < SVL_AVX512
+  using intrinsic_t = struct { half_t v0_1f, v20_3f; };
+#else
+  using intrinsic_t = __m512i;
+#endif
+  intrinsic_t data;
+
+  static self_t zeros() {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(half_t::zeros(), half_t::zeros());
+#else
+    return _mm512_setzero_si512();
+#endif
+  }
+
+  // Constructors
+  //! Default constructor
+  Vector64u8() = default;
+  //! Copy constructor
+  Vector64u8(const self_t&) = default;
+  //! Move constructor
+  Vector64u8(self_t&&) = default;
+  //! Copy assignment
+  self_t& operator=(const self_t&) = default;
+  //! Move assignment
+  self_t& operator=(self_t&&) = default;
+  //! Destructor
+  ~Vector64u8() = default;
+
+  //! Construct from an array
+  Vector64u8(const scalar_t* arr) { load(arr); }
+  //! Broadcast a value to all elements
+  Vector64u8(scalar_t v) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data = { half_t(v), half_t(v) };
+#else
+    data = _mm512_set1_epi8(char(v));
+#endif
+  }
+  //! Construct from two Vector32u8s
+  Vector64u8(const half_t& a, const half_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data = { a, b };
+#else
+    data = _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+#endif
+  }
+  //! Convert from intrinsic type
+  Vector64u8(const intrinsic_t& v) : data(v) { }
+  //! Covert to intrinsic type
+  operator intrinsic_t() const { return data; }
+  //! Assign from intrinsic type
+  self_t& operator=(const intrinsic_t& v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Assign from scalar type
+  self_t& operator=(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+
+  // Load/save data
+  //! Load values from an array
+  self_t& load(const scalar_t* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_1f.load(arr);
+    data.v20_3f.load(arr + half_step);
+#else
+    data = _mm512_loadu_si512((const __m512i*)arr);
+#endif
+    return *this;
+  }
+  //! Load n values from an array. Rest of data will be set to 0
+  self_t& load_partial(const scalar_t* arr, i64 n) {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_1f.load_partial(arr, n);
+    data.v20_3f.load_partial(arr + half_step, SVL_MAX(0, n - half_step));
+    return *this;
+#else
+    scalar_t tmp[step] = { };
+    memcpy(tmp, arr, n * sizeof(scalar_t));
+    return load(tmp);
+#endif
+  }
+  //! Load and broadcast a value to all elements
+  self_t& broadcast(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Store values in an array
+  void store(scalar_t* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_1f.store(arr);
+    data.v20_3f.store(arr + half_step);
+#else
+    _mm512_storeu_si512((__m512i*)arr, data);
+#endif
+  }
+  //! Store n values in an array
+  void store_partial(scalar_t* arr, i64 n) const {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    if (n <= half_step) data.v0_1f.store_partial(arr, n);
+    else {
+      data.v0_1f.store(arr);
+      data.v20_3f.store_partial(arr + half_step, n - half_step);
+    }
+#else
+    scalar_t tmp[step];
+    store(tmp);
+    memcpy(arr, tmp, n * sizeof(scalar_t));
+#endif
+  }
+
+  // Access single value
+  //! RO access to a single value
+  scalar_t access(i64 idx) const {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    return tmp[idx];
+  }
+  //! RO access to a single value
+  scalar_t operator[](i64 idx) const { return access(idx); }
+  //! Assign a single value
+  self_t& assign(scalar_t v, i64 idx) {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    tmp[idx] = v;
+    return load(tmp);
+  }
+
+  // Arithmetic operators, wrapping on overflow
+  //! Addition of two vectors
+  friend inline self_t operator+(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f + b.data.v0_1f, a.data.v20_3f + b.data.v20_3f);
+#else
+    return _mm512_add_epi8(a, b);
+#endif
+  }
+  //! Inplace addition of two vectors
+  friend inline self_t& operator+=(self_t& a, const self_t& b) {
+    a = a + b;
+    return a;
+  }
+  //! Subtraction of two vectors
+  friend inline self_t operator-(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f - b.data.v0_1f, a.data.v20_3f - b.data.v20_3f);
+#else
+    return _mm512_sub_epi8(a, b);
+#endif
+  }
+  //! Inplace subtraction of two vectors
+  friend inline self_t& operator-=(self_t& a, const self_t& b) {
+    a = a - b;
+    return a;
+  }
+
+  // Comparison operators
+  //! Returns a mask of all elements where a == b
+  friend inline self_t operator==(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f == b.data.v0_1f, a.data.v20_3f == b.data.v20_3f);
+#else
+    return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a, b));
+#endif
+  }
+  //! Returns a mask of all elements where a != b
+  friend inline self_t operator!=(const self_t& a, const self_t& b) {
+    return ~(a == b);
+  }
+  //! Returns a mask of all elements where a >= b
+  friend inline self_t operator>=(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f >= b.data.v0_1f, a.data.v20_3f >= b.data.v20_3f);
+#else
+    return _mm512_movm_epi8(_mm512_cmpge_epu8_mask(a, b));
+#endif
+  }
+  //! Returns a mask of all elements where a <= b
+  friend inline self_t operator<=(const self_t& a, const self_t& b) {
+    return b >= a;
+  }
+  //! Returns a mask of all elements where a > b
+  friend inline self_t operator>(const self_t& a, const self_t& b) {
+    return ~(b >= a);
+  }
+  //! Returns a mask of all elements where a < b
+  friend inline self_t operator<(const self_t& a, const self_t& b) {
+    return ~(a >= b);
+  }
+
+  // Logical operators
+  //! Bitwise AND of two vectors
+  friend inline self_t operator&(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f & b.data.v0_1f, a.data.v20_3f & b.data.v20_3f);
+#else
+    return _mm512_and_si512(a, b);
+#endif
+  }
+  //! Bitwise OR of two vectors
+  friend inline self_t operator|(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f | b.data.v0_1f, a.data.v20_3f | b.data.v20_3f);
+#else
+    return _mm512_or_si512(a, b);
+#endif
+  }
+  //! Bitwise XOR of two vectors
+  friend inline self_t operator^(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f ^ b.data.v0_1f, a.data.v20_3f ^ b.data.v20_3f);
+#else
+    return _mm512_xor_si512(a, b);
+#endif
+  }
+  //! Bitwise NOT of a vector
+  friend inline self_t operator~(const self_t& a) {
+    return a ^ self_t(0xFF);
+  }
+  //! Bitwise ANDNOT of two vectors, ~a & b
+  friend inline self_t and_not(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(and_not(a.data.v0_1f, b.data.v0_1f),
+                  and_not(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_andnot_si512(a, b);
+#endif
+  }
+
+  // Shifts
+  //! Shift all elements of a left by n bits
+  friend inline self_t operator<<(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f << n, a.data.v20_3f << n);
+#else
+    // Shift as 16 bit elements and clear the bits shifted in from the neighbour
+    __m512i r = _mm512_sll_epi16(a, _mm_cvtsi32_si128(n));
+    return _mm512_and_si512(r, _mm512_set1_epi8(char(n < 8 ? 0xFF << n : 0)));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in zeros
+  friend inline self_t operator>>(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_1f >> n, a.data.v20_3f >> n);
+#else
+    __m512i r = _mm512_srl_epi16(a, _mm_cvtsi32_si128(n));
+    return _mm512_and_si512(r, _mm512_set1_epi8(char(n < 8 ? 0xFF >> n : 0)));
+#endif
+  }
+
+  // General functions
+  //! Blend two vectors, taking elements from a where mask is set
+  friend inline self_t blend(const self_t& a, const self_t& b, const self_t& mask) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(blend(a.data.v0_1f, b.data.v0_1f, mask.data.v0_1f),
+                  blend(a.data.v20_3f, b.data.v20_3f, mask.data.v20_3f));
+#else
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), b, a);
+#endif
+  }
+  //! Elementwise maximum of a and b
+  friend inline self_t max(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(max(a.data.v0_1f, b.data.v0_1f),
+                  max(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_max_epu8(a, b);
+#endif
+  }
+  //! Elementwise minimum of a and b
+  friend inline self_t min(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(min(a.data.v0_1f, b.data.v0_1f),
+                  min(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_min_epu8(a, b);
+#endif
+  }
+  //! Addition of two vectors, saturating at 255
+  friend inline self_t add_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(add_saturated(a.data.v0_1f, b.data.v0_1f),
+                  add_saturated(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_adds_epu8(a, b);
+#endif
+  }
+  //! Subtraction of two vectors, saturating at 0
+  friend inline self_t sub_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(sub_saturated(a.data.v0_1f, b.data.v0_1f),
+                  sub_saturated(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_subs_epu8(a, b);
+#endif
+  }
+  //! Average of a and b rounded up, (a + b + 1) >> 1 without overflow
+  friend inline self_t avg(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(avg(a.data.v0_1f, b.data.v0_1f),
+                  avg(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_avg_epu8(a, b);
+#endif
+  }
+  //! High 8 bits of the 16 bit products of a and b
+  friend inline self_t mulhi(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(mulhi(a.data.v0_1f, b.data.v0_1f),
+                  mulhi(a.data.v20_3f, b.data.v20_3f));
+#else
+    // Multiply the even and odd bytes as 16 bit elements
+    const __m512i low_bytes = _mm512_set1_epi16(0xFF);
+    __m512i even = _mm512_mullo_epi16(_mm512_and_si512(a, low_bytes),
+                                   _mm512_and_si512(b, low_bytes));
+    __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8));
+    return _mm512_or_si512(_mm512_srli_epi16(even, 8), _mm512_andnot_si512(low_bytes, odd));
+#endif
+  }
+  //! Multiply the unsigned elements of a with the signed elements of b and add
+  //! neighbouring pairs of products, saturating to 16 bits
+  friend inline Vector32i16 maddubs(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return Vector32i16(maddubs(a.data.v0_1f, b.data.v0_1f),
+                    maddubs(a.data.v20_3f, b.data.v20_3f));
+#else
+    return _mm512_maddubs_epi16(a, b);
+#endif
+  }
+};
+
+#ifdef DEBUG
+static inline std::ostream& operator<<(std::ostream& os, const Vector64u8& v) {
+  os << "<";
+  SVL_FOR_RANGE(v.step) os << i32(v[i]) << ((i < (v.step - 1)) ? ", " : "");
+  os << ">";
+  return os;
+}
+#endif
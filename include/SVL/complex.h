@@ -0,0 +1,329 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <complex>
+
+// Complex numbers held in float vectors, in two layouts of V::step numbers:
+//
+//  SplitComplex<V>       : the real parts in re and the imaginary parts in
+//                          im, so arithmetic is plain vector arithmetic. abs,
+//                          arg and exp are only provided in this layout.
+//  InterleavedComplex<V> : the numbers in memory order, pairs of real and
+//                          imaginary parts, in lo then hi. This is the layout
+//                          of an array of std::complex<float>, and products
+//                          are formed with dup_even, dup_odd, swap_pairs and
+//                          fmaddsub without leaving it.
+//
+// Converting between the layouts is an interleave or deinterleave of the two
+// registers. Division scales the divisor by a power of two first, so only
+// quotients that are themselves out of range overflow.
+
+namespace SVL {
+  template <typename V> struct InterleavedComplex;
+
+  namespace detail {
+    //! Power of two bringing the larger of |a| and |b| into [1, 2), limited
+    //! to the normal range
+    template <typename V>
+    inline V division_scale(const V& a, const V& b) {
+      const V e = exponent(max(abs(a), abs(b)));
+      return pow2n(-min(max(e, V(-126.f)), V(126.f)));
+    }
+  }
+
+  //! V::step complex numbers with separate vectors of real and imaginary parts
+  template <typename V>
+  struct SplitComplex {
+    using self_t = SplitComplex<V>;
+    using vector_t = V;
+    using scalar_t = std::complex<flt>;
+    static const u32 step = V::step;
+
+    V re, im;
+
+    // Constructors
+    //! Default constructor
+    SplitComplex() = default;
+    //! Construct from the real and imaginary parts
+    SplitComplex(const V& re, const V& im) : re(re), im(im) { }
+    //! Construct from real numbers
+    SplitComplex(const V& re) : re(re), im(V::zeros()) { }
+    //! Construct from an array of step numbers
+    SplitComplex(const scalar_t* arr) { load(arr); }
+    //! Convert from the interleaved layout
+    explicit SplitComplex(const InterleavedComplex<V>& z) { deinterleave(z.lo, z.hi, re, im); }
+
+    static self_t zeros() { return self_t(V::zeros(), V::zeros()); }
+
+    // Load/save data
+    //! Load step numbers from an array
+    self_t& load(const scalar_t* arr) {
+      const flt* p = reinterpret_cast<const flt*>(arr);
+      deinterleave(V(p), V(p + step), re, im);
+      return *this;
+    }
+    //! Load n numbers from an array. The rest are set to 0
+    self_t& load_partial(const scalar_t* arr, i64 n) {
+      const flt* p = reinterpret_cast<const flt*>(arr);
+      n = SVL_CLAMP(0, n, i64(step));
+      deinterleave(V().load_partial(p, 2 * n), V().load_partial(p + step, 2 * n - step),
+                   re, im);
+      return *this;
+    }
+    //! Store the numbers in an array
+    void store(scalar_t* arr) const {
+      flt* p = reinterpret_cast<flt*>(arr);
+      V lo, hi;
+      interleave(re, im, lo, hi);
+      lo.store(p);
+      hi.store(p + step);
+    }
+    //! Store n numbers in an array
+    void store_partial(scalar_t* arr, i64 n) const {
+      flt* p = reinterpret_cast<flt*>(arr);
+      n = SVL_CLAMP(0, n, i64(step));
+      V lo, hi;
+      interleave(re, im, lo, hi);
+      lo.store_partial(p, 2 * n);
+      hi.store_partial(p + step, 2 * n - step);
+    }
+
+    // Access single value
+    //! RO access to a single number
+    scalar_t operator[](i64 idx) const { return scalar_t(re[idx], im[idx]); }
+
+    // Arithmetic operators
+    //! Addition of two vectors
+    friend inline self_t operator+(const self_t& a, const self_t& b) {
+      return self_t(a.re + b.re, a.im + b.im);
+    }
+    //! Subtraction of two vectors
+    friend inline self_t operator-(const self_t& a, const self_t& b) {
+      return self_t(a.re - b.re, a.im - b.im);
+    }
+    //! Negate all numbers
+    friend inline self_t operator-(const self_t& a) { return self_t(-a.re, -a.im); }
+    //! Multiplication of two vectors
+    friend inline self_t operator*(const self_t& a, const self_t& b) {
+      return self_t(fnma(a.im, b.im, a.re * b.re), fma(a.re, b.im, a.im * b.re));
+    }
+    //! Multiplication of a vector by real numbers
+    friend inline self_t operator*(const self_t& a, const V& b) {
+      return self_t(a.re * b, a.im * b);
+    }
+    //! Division of two vectors
+    friend inline self_t operator/(const self_t& a, const self_t& b) {
+      const V s = detail::division_scale(b.re, b.im);
+      const V br = b.re * s, bi = b.im * s;
+      const V d = s / fma(br, br, bi * bi);
+      return self_t(fma(a.re, br, a.im * bi) * d, fnma(a.re, bi, a.im * br) * d);
+    }
+    //! Division of a vector by real numbers
+    friend inline self_t operator/(const self_t& a, const V& b) {
+      return self_t(a.re / b, a.im / b);
+    }
+    //! Inplace addition of two vectors
+    friend inline self_t& operator+=(self_t& a, const self_t& b) { return a = a + b; }
+    //! Inplace subtraction of two vectors
+    friend inline self_t& operator-=(self_t& a, const self_t& b) { return a = a - b; }
+    //! Inplace multiplication of two vectors
+    friend inline self_t& operator*=(self_t& a, const self_t& b) { return a = a * b; }
+    //! Inplace division of two vectors
+    friend inline self_t& operator/=(self_t& a, const self_t& b) { return a = a / b; }
+
+    // General functions
+    //! Multiply add of a * b + c. Only fused from AVX2 upwards
+    friend inline self_t fma(const self_t& a, const self_t& b, const self_t& c) {
+      return self_t(fma(a.re, b.re, fnma(a.im, b.im, c.re)), fma(a.re, b.im, fma(a.im, b.re, c.im)));
+    }
+    //! Complex conjugate of all numbers
+    friend inline self_t conj(const self_t& a) { return self_t(a.re, -a.im); }
+    //! Squared magnitude of all numbers
+    friend inline V norm(const self_t& a) { return fma(a.re, a.re, a.im * a.im); }
+    //! Magnitude of all numbers, without overflowing for large parts
+    friend inline V abs(const self_t& a) { return fast::hypot(a.re, a.im); }
+    //! Phase angle of all numbers, in [-pi, pi]
+    friend inline V arg(const self_t& a) { return atan2(a.im, a.re); }
+    //! Complex exponential of all numbers, exp(re) (cos(im) + i sin(im))
+    friend inline self_t exp(const self_t& a) {
+      V s, c;
+      fast::sincos(a.im, s, c);
+      const V e = fast::exp(a.re);
+      // Real numbers stay real even when exp(re) is infinite
+      return self_t(e * c, blend(a.im, e * s, a.im == V::zeros()));
+    }
+  };
+
+  //! V::step complex numbers in memory order, the real and imaginary parts in
+  //! alternate elements of lo then hi
+  template <typename V>
+  struct InterleavedComplex {
+    using self_t = InterleavedComplex<V>;
+    using vector_t = V;
+    using scalar_t = std::complex<flt>;
+    static const u32 step = V::step;
+
+    V lo, hi;
+
+    // Constructors
+    //! Default constructor
+    InterleavedComplex() = default;
+    //! Construct from the interleaved halves
+    InterleavedComplex(const V& lo, const V& hi) : lo(lo), hi(hi) { }
+    //! Construct from an array of step numbers
+    InterleavedComplex(const scalar_t* arr) { load(arr); }
+    //! Convert from the split layout
+    explicit InterleavedComplex(const SplitComplex<V>& z) { interleave(z.re, z.im, lo, hi); }
+
+    static self_t zeros() { return self_t(V::zeros(), V::zeros()); }
+
+    // Load/save data
+    //! Load step numbers from an array
+    self_t& load(const scalar_t* arr) {
+      const flt* p = reinterpret_cast<const flt*>(arr);
+      lo.load(p);
+      hi.load(p + step);
+      return *this;
+    }
+    //! Load n numbers from an array. The rest are set to 0
+    self_t& load_partial(const scalar_t* arr, i64 n) {
+      const flt* p = reinterpret_cast<const flt*>(arr);
+      n = SVL_CLAMP(0, n, i64(step));
+      lo.load_partial(p, 2 * n);
+      hi.load_partial(p + step, 2 * n - step);
+      return *this;
+    }
+    //! Store the numbers in an array
+    void store(scalar_t* arr) const {
+      flt* p = reinterpret_cast<flt*>(arr);
+      lo.store(p);
+      hi.store(p + step);
+    }
+    //! Store n numbers in an array
+    void store_partial(scalar_t* arr, i64 n) const {
+      flt* p = reinterpret_cast<flt*>(arr);
+      n = SVL_CLAMP(0, n, i64(step));
+      lo.store_partial(p, 2 * n);
+      hi.store_partial(p + step, 2 * n - step);
+    }
+
+    // Access single value
+    //! RO access to a single number
+    scalar_t operator[](i64 idx) const {
+      const V& half = idx < i64(step / 2) ? lo : hi;
+      const i64 j = 2 * (idx % (step / 2));
+      return scalar_t(half[j], half[j + 1]);
+    }
+
+    // Products of single registers of pairs
+    //! x * y
+    static V multiply(const V& x, const V& y) {
+      return fmaddsub(x, dup_even(y), swap_pairs(x) * dup_odd(y));
+    }
+    //! x * conj(y)
+    static V multiply_conj(const V& x, const V& y) {
+      return fmaddsub(x, dup_even(y), -(swap_pairs(x) * dup_odd(y)));
+    }
+    //! x / y
+    static V divide(const V& x, const V& y) {
+      const V s = detail::division_scale(y, swap_pairs(y));
+      const V ys = y * s, n = ys * ys;
+      return multiply_conj(x, ys) * (s / (n + swap_pairs(n)));
+    }
+
+    // Arithmetic operators
+    //! Addition of two vectors
+    friend inline self_t operator+(const self_t& a, const self_t& b) {
+      return self_t(a.lo + b.lo, a.hi + b.hi);
+    }
+    //! Subtraction of two vectors
+    friend inline self_t operator-(const self_t& a, const self_t& b) {
+      return self_t(a.lo - b.lo, a.hi - b.hi);
+    }
+    //! Negate all numbers
+    friend inline self_t operator-(const self_t& a) { return self_t(-a.lo, -a.hi); }
+    //! Multiplication of two vectors
+    friend inline self_t operator*(const self_t& a, const self_t& b) {
+      return self_t(multiply(a.lo, b.lo), multiply(a.hi, b.hi));
+    }
+    //! Division of two vectors
+    friend inline self_t operator/(const self_t& a, const self_t& b) {
+      return self_t(divide(a.lo, b.lo), divide(a.hi, b.hi));
+    }
+    //! Inplace addition of two vectors
+    friend inline self_t& operator+=(self_t& a, const self_t& b) { return a = a + b; }
+    //! Inplace subtraction of two vectors
+    friend inline self_t& operator-=(self_t& a, const self_t& b) { return a = a - b; }
+    //! Inplace multiplication of two vectors
+    friend inline self_t& operator*=(self_t& a, const self_t& b) { return a = a * b; }
+    //! Inplace division of two vectors
+    friend inline self_t& operator/=(self_t& a, const self_t& b) { return a = a / b; }
+
+    // General functions
+    //! Complex conjugate of all numbers
+    friend inline self_t conj(const self_t& a) {
+      const V flip = constant<V, float_bits(1.f), float_bits(-1.f)>();
+      return self_t(a.lo * flip, a.hi * flip);
+    }
+  };
+
+  //! Four complex numbers, split into real and imaginary parts
+  using Complex4f = SplitComplex<Vec4f>;
+  //! Eight complex numbers, split into real and imaginary parts
+  using Complex8f = SplitComplex<Vec8f>;
+  //! Four complex numbers, interleaved as in memory
+  using Complex4fi = InterleavedComplex<Vec4f>;
+  //! Eight complex numbers, interleaved as in memory
+  using Complex8fi = InterleavedComplex<Vec8f>;
+
+  // Array kernels over std::complex<float>, in the interleaved layout so each
+  // register of V::step / 2 numbers is multiplied with no conversion
+  namespace detail {
+    //! out[i] = f(a[i], b[i], out[i]) over the pairs of n complex numbers
+    template <typename V, typename F>
+    inline void complex_map(i64 n, const std::complex<flt>* a, const std::complex<flt>* b,
+                            std::complex<flt>* out, F f) {
+      const flt* pa = reinterpret_cast<const flt*>(a);
+      const flt* pb = reinterpret_cast<const flt*>(b);
+      flt* po = reinterpret_cast<flt*>(out);
+      for (i64 i = 0; i < 2 * n; i += V::step) {
+        const i64 m = SVL_MIN(i64(V::step), 2 * n - i);
+        V r = f(load_elements<V, false>(pa + i, 1, m), load_elements<V, false>(pb + i, 1, m),
+                load_elements<V, false>(po + i, 1, m));
+        store_elements<V, false>(r, po + i, 1, m);
+      }
+    }
+  }
+
+  //! out[i] = a[i] * b[i] over the n complex numbers
+  template <typename V = Vec8f>
+  inline void complex_multiply(i64 n, const std::complex<flt>* a, const std::complex<flt>* b,
+                               std::complex<flt>* out) {
+    detail::complex_map<V>(n, a, b, out, [](const V& x, const V& y, const V&) {
+      return InterleavedComplex<V>::multiply(x, y);
+    });
+  }
+  //! acc[i] += a[i] * b[i] over the n complex numbers
+  template <typename V = Vec8f>
+  inline void complex_mac(i64 n, const std::complex<flt>* a, const std::complex<flt>* b,
+                          std::complex<flt>* acc) {
+    detail::complex_map<V>(n, a, b, acc, [](const V& x, const V& y, const V& c) {
+      return InterleavedComplex<V>::multiply(x, y) + c;
+    });
+  }
+  //! Sum of a[i] * b[i] over the n complex numbers
+  template <typename V = Vec8f>
+  inline std::complex<flt> complex_dot(i64 n, const std::complex<flt>* a,
+                                       const std::complex<flt>* b) {
+    const flt* pa = reinterpret_cast<const flt*>(a);
+    const flt* pb = reinterpret_cast<const flt*>(b);
+    V sum = detail::accumulate<V>(2 * n, [&](const V& acc, i64 i, i64 m) {
+      return acc + InterleavedComplex<V>::multiply(detail::load_elements<V, false>(pa + i, 1, m),
+                                                   detail::load_elements<V, false>(pb + i, 1, m));
+    }, detail::add());
+    V even, odd;
+    deinterleave(sum, V::zeros(), even, odd);
+    return std::complex<flt>(horizontal_add(even), horizontal_add(odd));
+  }
+}
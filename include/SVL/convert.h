@@ -0,0 +1,61 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+// Whole buffer conversions between float and the 16 bit storage formats.
+// Each converts V::step elements per iteration straight between the two
+// buffers, with a zero padded copy of the input for the tail, so the data
+// makes a single pass through memory.
+
+namespace SVL {
+  namespace detail {
+    //! Widen n 16 bit values from in to floats in out using load(v, ptr)
+    template <typename V, typename L>
+    inline void widen_u16(flt* out, const u16* in, i64 n, L load) {
+      V v;
+      i64 i = 0;
+      for (; i + V::step <= n; i += V::step) {
+        load(v, in + i);
+        v.store(out + i);
+      }
+      if (i < n) {
+        u16 tmp[V::step] = { };
+        memcpy(tmp, in + i, (n - i) * sizeof(u16));
+        load(v, tmp);
+        v.store_partial(out + i, n - i);
+      }
+    }
+    //! Narrow n floats from in to 16 bit values in out using store(v, ptr)
+    template <typename V, typename S>
+    inline void narrow_u16(u16* out, const flt* in, i64 n, S store) {
+      i64 i = 0;
+      for (; i + V::step <= n; i += V::step) store(V(in + i), out + i);
+      if (i < n) {
+        u16 tmp[V::step];
+        store(V().load_partial(in + i, n - i), tmp);
+        memcpy(out + i, tmp, (n - i) * sizeof(u16));
+      }
+    }
+  }
+
+  //! Convert n IEEE half precision values to floats
+  template <typename V = Vec8f>
+  inline void convert_f16_to_float(flt* out, const u16* in, i64 n) {
+    detail::widen_u16<V>(out, in, n, [](V& v, const u16* p) { v.load_f16(p); });
+  }
+  //! Convert n floats to IEEE half precision, rounding to nearest even
+  template <typename V = Vec8f>
+  inline void convert_float_to_f16(u16* out, const flt* in, i64 n) {
+    detail::narrow_u16<V>(out, in, n, [](const V& v, u16* p) { v.store_f16(p); });
+  }
+  //! Convert n bfloat16 values to floats
+  template <typename V = Vec8f>
+  inline void convert_bf16_to_float(flt* out, const u16* in, i64 n) {
+    detail::widen_u16<V>(out, in, n, [](V& v, const u16* p) { v.load_bf16(p); });
+  }
+  //! Convert n floats to bfloat16, rounding to nearest even
+  template <typename V = Vec8f>
+  inline void convert_float_to_bf16(u16* out, const flt* in, i64 n) {
+    detail::narrow_u16<V>(out, in, n, [](const V& v, u16* p) { v.store_bf16(p); });
+  }
+}
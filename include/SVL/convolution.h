@@ -0,0 +1,208 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+// FIR filters and 2D convolutions. The kernels keep a block of 4 registers
+// of outputs in registers, accumulating with fma, and load the input under
+// them a register at a time, 5 registers covering every window for the next
+// V::step taps. Windows an odd number of elements along are cut from those
+// registers with align and the even ones loaded again, which shares the work
+// between the shuffle unit and the load units better than either alone.
+
+namespace SVL {
+  namespace detail {
+    //! a_b += tap(first + S) * (window S along from x_b), for each S below
+    //! count, where tap(j) = last[-j] and in points at x0. With Shuffle
+    //! false every window is loaded, which is quicker for a few taps
+    template <typename V, bool Shuffle, int... S>
+    inline void window_fma(V& a0, V& a1, V& a2, V& a3, const V& x0, const V& x1, const V& x2,
+                           const V& x3, const V& x4, const flt* in, const flt* last, i64 first,
+                           i64 count, std::integer_sequence<int, S...>) {
+      auto one = [&](auto s) {
+        constexpr int shift = decltype(s)::value;
+        if (shift >= count) return;
+        const V tap(last[-(first + shift)]);
+        if constexpr (shift == 0) {
+          a0 = fma(tap, x0, a0);
+          a1 = fma(tap, x1, a1);
+          a2 = fma(tap, x2, a2);
+          a3 = fma(tap, x3, a3);
+        } else if constexpr (Shuffle && shift % 2 == 1) {
+          a0 = fma(tap, V::template align<shift>(x0, x1), a0);
+          a1 = fma(tap, V::template align<shift>(x1, x2), a1);
+          a2 = fma(tap, V::template align<shift>(x2, x3), a2);
+          a3 = fma(tap, V::template align<shift>(x3, x4), a3);
+        } else {
+          a0 = fma(tap, V(in + shift), a0);
+          a1 = fma(tap, V(in + shift + V::step), a1);
+          a2 = fma(tap, V(in + shift + 2 * V::step), a2);
+          a3 = fma(tap, V(in + shift + 3 * V::step), a3);
+        }
+      };
+      (one(std::integral_constant<int, S>()), ...);
+    }
+
+    //! a_b[i] += sum_j last[-j] in[b * step + i + j] over the k taps, reading
+    //! up to (4 + ceil(k / step)) * step elements of in
+    template <typename V>
+    inline void correlate(V& a0, V& a1, V& a2, V& a3, const flt* in, const flt* last, i64 k) {
+      for (i64 first = 0; first < k; first += V::step) {
+        const flt* p = in + first;
+        const V x0(p), x1(p + V::step), x2(p + 2 * V::step), x3(p + 3 * V::step);
+        const V x4(p + 4 * V::step);
+        const i64 count = SVL_MIN(i64(V::step), k - first);
+        if (count > 3)
+          window_fma<V, true>(a0, a1, a2, a3, x0, x1, x2, x3, x4, p, last, first, count,
+                              std::make_integer_sequence<int, V::step>());
+        else
+          window_fma<V, false>(a0, a1, a2, a3, x0, x1, x2, x3, x4, p, last, first, count,
+                               std::make_integer_sequence<int, V::step>());
+      }
+    }
+
+    //! out[i] = sum_j last[-j] in[i + j] for i in [0, n), over the k taps
+    //! ending at last, where in holds n + k - 1 elements. With rows above 1,
+    //! sums the same over each row r of in and taps, from in + r * in_stride
+    //! and last + r * row_taps
+    template <typename V>
+    inline void correlate_rows(i64 n, const flt* in, i64 rows, i64 in_stride, const flt* last,
+                               i64 row_taps, i64 k, flt* out) {
+      const i64 len = n + k - 1, block = 4 * V::step;
+      const i64 reach = (4 + (k + V::step - 1) / V::step) * V::step;
+      i64 i = 0;
+      for (; i + block <= n && i + reach <= len; i += block) {
+        V a0 = V::zeros(), a1 = a0, a2 = a0, a3 = a0;
+        for (i64 r = 0; r < rows; ++r)
+          correlate(a0, a1, a2, a3, in + r * in_stride + i, last + r * row_taps, k);
+        a0.store(out + i);
+        a1.store(out + i + V::step);
+        a2.store(out + i + 2 * V::step);
+        a3.store(out + i + 3 * V::step);
+      }
+      // A register at a time for the rest, reading only within the input
+      for (; i < n; i += V::step) {
+        V acc = V::zeros();
+        for (i64 r = 0; r < rows; ++r) {
+          const flt* row = in + r * in_stride + i;
+          for (i64 j = 0; j < k; ++j) {
+            const i64 left = len - i - j;
+            const V x = left >= i64(V::step) ? V(row + j) : V().load_partial(row + j, left);
+            acc = fma(V(last[r * row_taps - j]), x, acc);
+          }
+        }
+        if (n - i >= i64(V::step)) acc.store(out + i);
+        else acc.store_partial(out + i, n - i);
+      }
+    }
+
+    //! f(begin, end) for bands of the rows rows split between up to threads
+    //! threads, using threads only when there are about work >> 20 flops
+    template <typename F>
+    inline void split_rows(i64 rows, i64 work, i64 threads, F f) {
+      // Don't bother with threads for less than about a million multiply adds each
+      threads = SVL_CLAMP(1, threads, SVL_MIN(rows, SVL_MAX(1, work >> 20)));
+      if (threads == 1) return f(i64(0), rows);
+      const i64 per_thread = (rows + threads - 1) / threads;
+      std::vector<std::thread> workers;
+      for (i64 t = 0; t < threads; ++t)
+        workers.emplace_back([&, t]() {
+          const i64 begin = SVL_MIN(t * per_thread, rows);
+          f(begin, SVL_MIN(begin + per_thread, rows));
+        });
+      for (std::thread& w : workers) w.join();
+    }
+  }
+
+  //! FIR filter out[i] = sum_j taps[j] in[i + k - 1 - j] of the k taps, for
+  //! i in [0, n). in holds the k - 1 previous samples followed by the n new
+  //! ones, and mustn't overlap out
+  template <typename V = Vec8f>
+  inline void fir(i64 n, const flt* in, const flt* taps, i64 k, flt* out) {
+    if (n <= 0 || k <= 0) return;
+    // Convolution is correlation with the taps reversed
+    detail::correlate_rows<V>(n, in, 1, 0, taps + k - 1, 0, k, out);
+  }
+
+  //! 2D convolution out[r][c] = sum_ij kernel[i][j] in[r + kr - 1 - i][c + kc - 1 - j]
+  //! of a kr x kc kernel, for the rows x cols outputs. in holds
+  //! rows + kr - 1 rows of cols + kc - 1 elements, so any border is up to
+  //! the caller. All are row major, with row strides in_stride and
+  //! out_stride and the kernel's rows contiguous
+  template <typename V = Vec8f>
+  inline void conv2d(i64 rows, i64 cols, const flt* in, i64 in_stride, const flt* kernel,
+                     i64 kr, i64 kc, flt* out, i64 out_stride) {
+    if (rows <= 0 || cols <= 0 || kr <= 0 || kc <= 0) return;
+    // Kernel row kr - 1 - i reversed meets input row r + i
+    const flt* last = kernel + kr * kc - 1;
+    for (i64 r = 0; r < rows; ++r)
+      detail::correlate_rows<V>(cols, in + r * in_stride, kr, in_stride, last, -kc, kc,
+                                out + r * out_stride);
+  }
+
+  //! conv2d with the separable kernel kernel[i][j] = column[i] row[j], of kr
+  //! column taps and kc row taps. Each input row is filtered by row once and
+  //! the last kr of those filtered by column, for kr + kc rather than
+  //! kr * kc multiply adds per output
+  template <typename V = Vec8f>
+  inline void conv2d_separable(i64 rows, i64 cols, const flt* in, i64 in_stride, const flt* row,
+                               i64 kc, const flt* column, i64 kr, flt* out, i64 out_stride) {
+    if (rows <= 0 || cols <= 0 || kr <= 0 || kc <= 0) return;
+    // The rows filtered by row, input row q held in filtered row q % kr
+    std::vector<flt> filtered(kr * cols);
+    std::vector<const flt*> sources(kr);
+    for (i64 q = 0; q < rows + kr - 1; ++q) {
+      fir<V>(cols, in + q * in_stride, row, kc, filtered.data() + (q % kr) * cols);
+      if (q < kr - 1) continue;
+      // Output row q - kr + 1 takes column[i] of filtered input row q - i
+      for (i64 i = 0; i < kr; ++i) sources[i] = filtered.data() + ((q - i) % kr) * cols;
+      flt* o = out + (q - kr + 1) * out_stride;
+      i64 c = 0;
+      for (; c + 2 * i64(V::step) <= cols; c += 2 * V::step) {
+        V a0 = V::zeros(), a1 = a0;
+        for (i64 i = 0; i < kr; ++i) {
+          const V tap(column[i]);
+          a0 = fma(tap, V(sources[i] + c), a0);
+          a1 = fma(tap, V(sources[i] + c + V::step), a1);
+        }
+        a0.store(o + c);
+        a1.store(o + c + V::step);
+      }
+      for (; c < cols; c += V::step) {
+        const i64 left = SVL_MIN(i64(V::step), cols - c);
+        V acc = V::zeros();
+        for (i64 i = 0; i < kr; ++i)
+          acc = fma(V(column[i]), V().load_partial(sources[i] + c, left), acc);
+        acc.store_partial(o + c, left);
+      }
+    }
+  }
+
+  //! conv2d with bands of output rows split between up to threads threads
+  template <typename V = Vec8f>
+  inline void parallel_conv2d(i64 rows, i64 cols, const flt* in, i64 in_stride,
+                              const flt* kernel, i64 kr, i64 kc, flt* out, i64 out_stride,
+                              i64 threads = std::thread::hardware_concurrency()) {
+    detail::split_rows(rows, rows * cols * kr * kc, threads, [&](i64 begin, i64 end) {
+      conv2d<V>(end - begin, cols, in + begin * in_stride, in_stride, kernel, kr, kc,
+                out + begin * out_stride, out_stride);
+    });
+  }
+
+  //! conv2d_separable with bands of output rows split between up to threads
+  //! threads. Each band filters the kr - 1 input rows it shares with the one
+  //! before it again
+  template <typename V = Vec8f>
+  inline void parallel_conv2d_separable(i64 rows, i64 cols, const flt* in, i64 in_stride,
+                                        const flt* row, i64 kc, const flt* column, i64 kr,
+                                        flt* out, i64 out_stride,
+                                        i64 threads = std::thread::hardware_concurrency()) {
+    detail::split_rows(rows, rows * cols * (kr + kc), threads, [&](i64 begin, i64 end) {
+      conv2d_separable<V>(end - begin, cols, in + begin * in_stride, in_stride, row, kc, column,
+                          kr, out + begin * out_stride, out_stride);
+    });
+  }
+}
@@ -0,0 +1,166 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <tuple>
+#include <type_traits>
+
+// Lazy expressions over arrays of floats. Combining spans and scalars with the
+// usual operators and math functions only builds a tree describing the
+// calculation, e.g.
+//
+//   using namespace SVL::expr;
+//   evaluate(out, n, span(a, n) * span(b, n) + span(c, n) * 2.f - sqrt(span(d, n)));
+//
+// evaluate then runs the whole tree in a single loop, one vector of step
+// elements at a time with a partial load/store for the tail, so no temporary
+// arrays are needed and every input is read exactly once.
+
+namespace SVL::expr {
+  //! Leaf referring to n contiguous floats
+  struct Span {
+    const flt* data;
+    i64 n;
+
+    i64 size() const { return n; }
+    template <typename V> V load(i64 i) const { return V(data + i); }
+    template <typename V> V load_partial(i64 i, i64 m) const {
+      return V().load_partial(data + i, m);
+    }
+  };
+
+  //! Leaf with the same value for every element
+  struct Scalar {
+    flt value;
+
+    //! Scalars never limit the length of an expression
+    i64 size() const { return INT64_MAX; }
+    template <typename V> V load(i64) const { return V(value); }
+    template <typename V> V load_partial(i64, i64) const { return V(value); }
+  };
+
+  //! Node applying op to the values of its children
+  template <typename Op, typename... Args>
+  struct Node {
+    Op op;
+    std::tuple<Args...> args;
+
+    //! Length of the shortest child
+    i64 size() const {
+      return std::apply([](const Args&... a) {
+        i64 n = INT64_MAX;
+        ((n = SVL_MIN(n, a.size())), ...);
+        return n;
+      }, args);
+    }
+    template <typename V> V load(i64 i) const {
+      return std::apply([&](const Args&... a) {
+        return op(a.template load<V>(i)...);
+      }, args);
+    }
+    template <typename V> V load_partial(i64 i, i64 m) const {
+      return std::apply([&](const Args&... a) {
+        return op(a.template load_partial<V>(i, m)...);
+      }, args);
+    }
+  };
+
+  template <typename T> struct is_expr : std::false_type { };
+  template <> struct is_expr<Span> : std::true_type { };
+  template <> struct is_expr<Scalar> : std::true_type { };
+  template <typename Op, typename... Args>
+  struct is_expr<Node<Op, Args...>> : std::true_type { };
+
+  //! True if T can be an operand of an expression
+  template <typename T>
+  constexpr bool is_operand = is_expr<T>::value || std::is_arithmetic<T>::value;
+  //! True if Ts are all operands and at least one of them is an expression
+  template <typename... Ts>
+  constexpr bool any_expr = (is_operand<Ts> && ...) && (is_expr<Ts>::value || ...);
+
+  //! Expression for the n floats starting at data
+  inline Span span(const flt* data, i64 n) { return Span{ data, n }; }
+
+  //! Turn an operand into an expression
+  template <typename T>
+  inline auto as_expr(const T& x) {
+    if constexpr (is_expr<T>::value) return x;
+    else return Scalar{ flt(x) };
+  }
+
+  //! Expression applying op to the given operands
+  template <typename Op, typename... Ts>
+  inline auto make_node(Op op, const Ts&... xs) {
+    return Node<Op, decltype(as_expr(xs))...>{ op, { as_expr(xs)... } };
+  }
+
+  //! Expression applying f, callable with any Vector*f type, to every element
+  //! of the operands, e.g. map([](auto v) { return SVL::fast::exp(v); }, e)
+  template <typename F, typename... Ts,
+            typename = std::enable_if_t<any_expr<Ts...>>>
+  inline auto map(F f, const Ts&... xs) { return make_node(f, xs...); }
+
+  //! Evaluate e for its first n elements (or all of them if shorter) into out,
+  //! processing V::step elements at a time. out may alias one of the inputs
+  template <typename V = Vec8f, typename E,
+            typename = std::enable_if_t<is_expr<E>::value>>
+  inline void evaluate(flt* out, i64 n, const E& e) {
+    n = SVL_MIN(n, e.size());
+    i64 i = 0;
+    for (; i + V::step <= n; i += V::step)
+      e.template load<V>(i).store(out + i);
+    if (i < n)
+      e.template load_partial<V>(i, n - i).store_partial(out + i, n - i);
+  }
+
+  // Operators
+#define SVL_EXPR_BINARY_OPERATOR(op, name) \
+  struct name { \
+    template <typename V> V operator()(const V& a, const V& b) const { return a op b; } \
+  }; \
+  template <typename A, typename B, typename = std::enable_if_t<any_expr<A, B>>> \
+  inline auto operator op(const A& a, const B& b) { return make_node(name{}, a, b); }
+
+  SVL_EXPR_BINARY_OPERATOR(+, Add)
+  SVL_EXPR_BINARY_OPERATOR(-, Subtract)
+  SVL_EXPR_BINARY_OPERATOR(*, Multiply)
+  SVL_EXPR_BINARY_OPERATOR(/, Divide)
+#undef SVL_EXPR_BINARY_OPERATOR
+
+  //! Negate every element of a
+  template <typename A, typename = std::enable_if_t<any_expr<A>>>
+  inline auto operator-(const A& a) {
+    return map([](const auto& v) { return -v; }, a);
+  }
+
+  // Math functions, forwarding to the Vector*f friend functions
+#define SVL_EXPR_FUNCTION(name, arity) \
+  struct name##_op { \
+    template <typename... V> auto operator()(const V&... v) const { return name(v...); } \
+  }; \
+  template <typename... Ts, typename = std::enable_if_t<any_expr<Ts...>>> \
+  inline auto name(const Ts&... xs) { \
+    static_assert(sizeof...(Ts) == arity, "Wrong number of arguments for " #name); \
+    return make_node(name##_op{}, xs...); \
+  }
+
+  SVL_EXPR_FUNCTION(min, 2)
+  SVL_EXPR_FUNCTION(max, 2)
+  SVL_EXPR_FUNCTION(fma, 3)
+  SVL_EXPR_FUNCTION(fnma, 3)
+  SVL_EXPR_FUNCTION(abs, 1)
+  SVL_EXPR_FUNCTION(sqrt, 1)
+  SVL_EXPR_FUNCTION(rcp_nr, 1)
+  SVL_EXPR_FUNCTION(rsqrt_nr, 1)
+  SVL_EXPR_FUNCTION(floor, 1)
+  SVL_EXPR_FUNCTION(ceil, 1)
+  SVL_EXPR_FUNCTION(round, 1)
+  SVL_EXPR_FUNCTION(sin, 1)
+  SVL_EXPR_FUNCTION(cos, 1)
+  SVL_EXPR_FUNCTION(tan, 1)
+  SVL_EXPR_FUNCTION(asin, 1)
+  SVL_EXPR_FUNCTION(acos, 1)
+  SVL_EXPR_FUNCTION(atan, 1)
+  SVL_EXPR_FUNCTION(atan2, 2)
+#undef SVL_EXPR_FUNCTION
+}
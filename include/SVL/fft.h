@@ -0,0 +1,481 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Fast Fourier transforms of power of two sizes on split complex arrays (the
+// real parts in one array, the imaginary parts in another), using the
+// Stockham autosort algorithm so no bit reversal pass is needed. Each pass
+// reads one buffer and writes the other.
+//
+// The first pass is a radix V::step pass vectorised over the butterflies:
+// V::step registers of inputs go through a V::step point DFT held in
+// registers and are transposed on the way out. Every later pass then works
+// on runs of at least V::step contiguous elements, so those are radix 4
+// passes (plus one radix 2 pass for odd powers) vectorised over the runs.
+// Sizes below V::step^2 use a scalar radix 2 transform.
+//
+// The forward transform is X[k] = sum_j x[j] exp(-2 pi i j k / n) and the
+// inverse uses exp(+2 pi i j k / n) without the 1 / n scaling. Twiddles are
+// evaluated in double precision when a plan is made, and plans are cached
+// per size by fft_plan and real_fft_plan.
+
+namespace SVL {
+  namespace detail {
+    //! 64 byte aligned array of n floats
+    struct aligned_floats {
+      struct deleter {
+        void operator()(flt* p) const { ::operator delete[](p, std::align_val_t(64)); }
+      };
+      std::unique_ptr<flt[], deleter> data;
+
+      aligned_floats() = default;
+      explicit aligned_floats(i64 n)
+          : data(static_cast<flt*>(::operator new[](sizeof(flt) * u64(SVL_MAX(n, i64(1))),
+                                                     std::align_val_t(64)))) { }
+      flt* get() const { return data.get(); }
+    };
+
+    //! Per thread scratch space of at least n floats. Each Tag gets its own
+    //! buffer, so nested users don't share one
+    template <typename Tag>
+    inline flt* fft_scratch(i64 n) {
+      thread_local std::vector<flt> buffer;
+      if (i64(buffer.size()) < n) buffer.resize(n);
+      return buffer.data();
+    }
+    struct fft_work_tag { };
+    struct real_fft_work_tag { };
+
+    //! exp(-2 pi i e / n) rounded to float
+    inline void twiddle(i64 e, i64 n, flt& re, flt& im) {
+      const dbl angle = -6.283185307179586477 * dbl(e % n) / dbl(n);
+      re = flt(std::cos(angle));
+      im = flt(std::sin(angle));
+    }
+
+    //! Reverse the low bits of k, where there are log2(size) of them
+    constexpr i64 bit_reverse(i64 k, i64 size) {
+      i64 r = 0;
+      for (i64 b = 1; b < size; b *= 2) r = 2 * r + ((k & b) ? 1 : 0);
+      return r;
+    }
+
+    //! Transpose the V::step x V::step matrix held in the registers rows, by
+    //! log2(V::step) rounds of perfect shuffles
+    template <typename V>
+    inline void transpose(V* rows) {
+      const i64 r = V::step;
+      for (i64 round = 1; round < r; round *= 2) {
+        V t[V::step];
+        for (i64 i = 0; i < r / 2; ++i) interleave(rows[i], rows[i + r / 2], t[2 * i], t[2 * i + 1]);
+        for (i64 i = 0; i < r; ++i) rows[i] = t[i];
+      }
+    }
+  }
+
+  //! Precomputed twiddles for forward and inverse FFTs of n complex numbers,
+  //! with n a power of two
+  template <typename V = Vec8f>
+  struct FFTPlan {
+    using complex_t = SplitComplex<V>;
+    static const i64 radix = V::step;
+
+    //! One radix 4 or radix 2 pass over sub-transforms of n with s
+    //! interleaved, and its twiddles at offset in twiddles
+    struct pass {
+      i64 n, s, radix, offset;
+    };
+
+    i64 n;
+    //! Whether the size is large enough for the vectorised passes
+    bool vectorised;
+    std::vector<pass> passes;
+    //! The first pass twiddles exp(-2 pi i p k / n), for k in [1, radix) the
+    //! real parts for every p then the imaginary parts. Scalar transforms
+    //! hold exp(-2 pi i p / n) for p below n / 2 here instead
+    detail::aligned_floats first;
+    //! exp(-2 pi i j / radix) for j below radix / 2, real parts then
+    //! imaginary parts
+    detail::aligned_floats unit;
+    //! The twiddles of every later pass, as (re, im) for each power
+    detail::aligned_floats twiddles;
+
+    explicit FFTPlan(i64 n) : n(n), vectorised(n >= radix * radix) {
+      if (!vectorised) {
+        first = detail::aligned_floats(n);
+        for (i64 p = 0; p < n / 2; ++p) detail::twiddle(p, n, first.get()[p], first.get()[n / 2 + p]);
+        return;
+      }
+      const i64 m = n / radix;
+      first = detail::aligned_floats(2 * (radix - 1) * m);
+      for (i64 k = 1; k < radix; ++k) {
+        flt* t = first.get() + 2 * (k - 1) * m;
+        for (i64 p = 0; p < m; ++p) detail::twiddle(p * k, n, t[p], t[m + p]);
+      }
+      unit = detail::aligned_floats(radix);
+      for (i64 j = 0; j < radix / 2; ++j)
+        detail::twiddle(j, radix, unit.get()[j], unit.get()[radix / 2 + j]);
+      // Radix 4 passes while there are two or more factors of 2 left
+      i64 size = 0;
+      for (i64 sub = m, s = radix; sub > 1;) {
+        const i64 r = sub >= 4 ? 4 : 2;
+        passes.push_back({ sub, s, r, size });
+        size += 2 * (r - 1) * (sub / r);
+        sub /= r;
+        s *= r;
+      }
+      twiddles = detail::aligned_floats(size);
+      for (const pass& ps : passes) {
+        flt* t = twiddles.get() + ps.offset;
+        for (i64 p = 0; p < ps.n / ps.radix; ++p)
+          for (i64 k = 1; k < ps.radix; ++k, t += 2) detail::twiddle(p * k, ps.n, t[0], t[1]);
+      }
+    }
+    FFTPlan(const FFTPlan&) = delete;
+    FFTPlan& operator=(const FFTPlan&) = delete;
+
+    //! Number of complex numbers transformed
+    i64 size() const { return n; }
+
+    //! In place forward transform of the real parts re and imaginary parts im
+    void forward(flt* re, flt* im) const {
+      if (n <= 1) return;
+      flt* work = detail::fft_scratch<detail::fft_work_tag>(2 * n);
+      if (!vectorised) return scalar_forward(re, im, work, work + n);
+      first_pass(re, im, work, work + n);
+      // Ping pong between the work space and the arrays
+      flt *xre = work, *xim = work + n, *yre = re, *yim = im;
+      for (const pass& ps : passes) {
+        if (ps.radix == 4) radix4_pass(ps, xre, xim, yre, yim);
+        else radix2_pass(ps, xre, xim, yre, yim);
+        std::swap(xre, yre);
+        std::swap(xim, yim);
+      }
+      if (xre != re) {
+        memcpy(re, xre, sizeof(flt) * u64(n));
+        memcpy(im, xim, sizeof(flt) * u64(n));
+      }
+    }
+    //! In place inverse transform, without scaling by 1 / n
+    void inverse(flt* re, flt* im) const {
+      // Swapping the parts conjugates the input and output
+      forward(im, re);
+    }
+    //! forward on each of rows transforms, row r at re + r * stride and
+    //! im + r * stride, split between up to threads threads
+    void forward(i64 rows, flt* re, flt* im, i64 stride, i64 threads = 1) const {
+      for_rows(rows, threads, [&](i64 r) { forward(re + r * stride, im + r * stride); });
+    }
+    //! inverse on each of rows transforms, laid out as for forward
+    void inverse(i64 rows, flt* re, flt* im, i64 stride, i64 threads = 1) const {
+      for_rows(rows, threads, [&](i64 r) { inverse(re + r * stride, im + r * stride); });
+    }
+
+   private:
+    //! f(r) for each row r, split between up to threads threads
+    template <typename F>
+    void for_rows(i64 rows, i64 threads, F f) const {
+      threads = SVL_CLAMP(1, threads, rows);
+      if (threads == 1) {
+        for (i64 r = 0; r < rows; ++r) f(r);
+        return;
+      }
+      const i64 per_thread = (rows + threads - 1) / threads;
+      std::vector<std::thread> workers;
+      for (i64 t = 0; t < threads; ++t)
+        workers.emplace_back([&, t]() {
+          for (i64 r = t * per_thread; r < SVL_MIN(rows, (t + 1) * per_thread); ++r) f(r);
+        });
+      for (std::thread& w : workers) w.join();
+    }
+
+    //! Radix 2 Stockham transform one element at a time, for small sizes
+    void scalar_forward(flt* re, flt* im, flt* wre, flt* wim) const {
+      flt *xre = re, *xim = im, *yre = wre, *yim = wim;
+      const flt* tre = first.get();
+      const flt* tim = tre + n / 2;
+      for (i64 sub = n, s = 1; sub > 1; sub /= 2, s *= 2) {
+        const i64 m = sub / 2;
+        for (i64 p = 0; p < m; ++p) {
+          const flt wr = tre[p * s], wi = tim[p * s];
+          for (i64 q = 0; q < s; ++q) {
+            const i64 a = q + s * p, b = a + s * m, c = q + s * 2 * p;
+            const flt dr = xre[a] - xre[b], di = xim[a] - xim[b];
+            yre[c] = xre[a] + xre[b];
+            yim[c] = xim[a] + xim[b];
+            yre[c + s] = dr * wr - di * wi;
+            yim[c + s] = dr * wi + di * wr;
+          }
+        }
+        std::swap(xre, yre);
+        std::swap(xim, yim);
+      }
+      if (xre != re) {
+        memcpy(re, xre, sizeof(flt) * u64(n));
+        memcpy(im, xim, sizeof(flt) * u64(n));
+      }
+    }
+
+    //! Radix V::step pass from x to y, vectorised over the butterflies. Each
+    //! register of outputs comes out as a row of the transpose
+    void first_pass(const flt* xre, const flt* xim, flt* yre, flt* yim) const {
+      const i64 m = n / radix;
+      const flt* ure = unit.get();
+      const flt* uim = ure + radix / 2;
+      for (i64 p = 0; p < m; p += radix) {
+        complex_t x[radix];
+        for (i64 j = 0; j < radix; ++j) x[j] = complex_t(V(xre + p + j * m), V(xim + p + j * m));
+        // Decimation in frequency across the registers, leaving output k in
+        // x[bit_reverse(k)]
+        for (i64 len = radix; len >= 2; len /= 2) {
+          const i64 half = len / 2, stride = radix / len;
+          for (i64 b = 0; b < radix; b += len) {
+            for (i64 j = 0; j < half; ++j) {
+              const complex_t a = x[b + j], c = x[b + j + half];
+              x[b + j] = a + c;
+              if (j == 0) x[b + j + half] = a - c;
+              else x[b + j + half] = (a - c) * complex_t(V(ure[j * stride]), V(uim[j * stride]));
+            }
+          }
+        }
+        V re_rows[radix], im_rows[radix];
+        for (i64 k = 0; k < radix; ++k) {
+          complex_t y = x[detail::bit_reverse(k, radix)];
+          if (k > 0) {
+            const flt* t = first.get() + 2 * (k - 1) * m + p;
+            y = y * complex_t(V(t), V(t + m));
+          }
+          re_rows[k] = y.re;
+          im_rows[k] = y.im;
+        }
+        // Output k of butterfly p goes to y[radix * p + k]
+        detail::transpose(re_rows);
+        detail::transpose(im_rows);
+        for (i64 l = 0; l < radix; ++l) {
+          re_rows[l].store(yre + radix * (p + l));
+          im_rows[l].store(yim + radix * (p + l));
+        }
+      }
+    }
+
+    //! Radix 4 pass from x to y, vectorised over runs of s elements
+    void radix4_pass(const pass& ps, const flt* xre, const flt* xim, flt* yre, flt* yim) const {
+      const i64 m = ps.n / 4, s = ps.s;
+      const flt* t = twiddles.get() + ps.offset;
+      for (i64 p = 0; p < m; ++p, t += 6) {
+        const complex_t w1{ V(t[0]), V(t[1]) }, w2{ V(t[2]), V(t[3]) }, w3{ V(t[4]), V(t[5]) };
+        const i64 in = s * p, out = s * 4 * p;
+        for (i64 q = 0; q < s; q += radix) {
+          auto load = [&](i64 j) {
+            const i64 o = q + in + j * s * m;
+            return complex_t(V(xre + o), V(xim + o));
+          };
+          auto store = [&](i64 k, const complex_t& z) {
+            z.re.store(yre + q + out + k * s);
+            z.im.store(yim + q + out + k * s);
+          };
+          const complex_t a = load(0), b = load(1), c = load(2), d = load(3);
+          const complex_t apc = a + c, amc = a - c, bpd = b + d, bmd = b - d;
+          // -i (b - d)
+          const complex_t jbmd(bmd.im, -bmd.re);
+          store(0, apc + bpd);
+          store(1, (amc + jbmd) * w1);
+          store(2, (apc - bpd) * w2);
+          store(3, (amc - jbmd) * w3);
+        }
+      }
+    }
+
+    //! Radix 2 pass from x to y, vectorised over runs of s elements
+    void radix2_pass(const pass& ps, const flt* xre, const flt* xim, flt* yre, flt* yim) const {
+      const i64 m = ps.n / 2, s = ps.s;
+      const flt* t = twiddles.get() + ps.offset;
+      for (i64 p = 0; p < m; ++p, t += 2) {
+        const complex_t w{ V(t[0]), V(t[1]) };
+        const i64 in = s * p, out = s * 2 * p;
+        for (i64 q = 0; q < s; q += radix) {
+          const complex_t a(V(xre + q + in), V(xim + q + in));
+          const complex_t b(V(xre + q + in + s * m), V(xim + q + in + s * m));
+          const complex_t sum = a + b, diff = (a - b) * w;
+          sum.re.store(yre + q + out);
+          sum.im.store(yim + q + out);
+          diff.re.store(yre + q + out + s);
+          diff.im.store(yim + q + out + s);
+        }
+      }
+    }
+  };
+
+  //! Precomputed twiddles for FFTs of n real numbers, with n a power of two
+  //! and at least 2. The n / 2 + 1 non redundant outputs are computed from a
+  //! complex transform of n / 2, the even inputs as real parts and the odd
+  //! ones as imaginary parts
+  template <typename V = Vec8f>
+  struct RealFFTPlan {
+    using complex_t = SplitComplex<V>;
+
+    i64 n;
+    FFTPlan<V> half;
+    //! exp(-2 pi i k / n) for k up to n / 4, real parts then imaginary parts
+    detail::aligned_floats twiddles;
+
+    explicit RealFFTPlan(i64 n) : n(n), half(n / 2) {
+      const i64 h = n / 2, count = h / 2 + 1;
+      twiddles = detail::aligned_floats(2 * count);
+      for (i64 k = 0; k < count; ++k)
+        detail::twiddle(k, n, twiddles.get()[k], twiddles.get()[count + k]);
+    }
+    RealFFTPlan(const RealFFTPlan&) = delete;
+    RealFFTPlan& operator=(const RealFFTPlan&) = delete;
+
+    //! Number of real numbers transformed
+    i64 size() const { return n; }
+
+    //! Forward transform of the n reals x into the n / 2 + 1 outputs re and
+    //! im. The rest follow from X[n - k] = conj(X[k])
+    void forward(const flt* x, flt* re, flt* im) const {
+      const i64 h = n / 2;
+      deinterleave_input(x, re, im);
+      half.forward(re, im);
+      // X[k] = E + w^k O and X[h - k] = conj(E - w^k O), with
+      // E = (Z[k] + conj(Z[h - k])) / 2 and O = -i (Z[k] - conj(Z[h - k])) / 2
+      const flt z0r = re[0], z0i = im[0];
+      re[0] = z0r + z0i;
+      im[0] = 0.f;
+      re[h] = z0r - z0i;
+      im[h] = 0.f;
+      combine(re, im, [](const complex_t& zk, const complex_t& zm, const complex_t& w,
+                         complex_t& xk, complex_t& xm) {
+        const complex_t e = (zk + conj(zm)) * V(0.5f);
+        const complex_t d = (zk - conj(zm)) * V(0.5f);
+        // w * -i d
+        const complex_t t = complex_t(d.im, -d.re) * w;
+        xk = e + t;
+        xm = conj(e - t);
+      });
+    }
+    //! Inverse transform of the n / 2 + 1 values re and im into the n reals
+    //! x, without scaling by 1 / n. The imaginary parts of the first and
+    //! last values are ignored
+    void inverse(const flt* re, const flt* im, flt* x) const {
+      const i64 h = n / 2;
+      flt* zre = detail::fft_scratch<detail::real_fft_work_tag>(2 * h + 2);
+      flt* zim = zre + h + 1;
+      memcpy(zre, re, sizeof(flt) * u64(h + 1));
+      memcpy(zim, im, sizeof(flt) * u64(h + 1));
+      // Z[k] = A + i B and Z[h - k] = conj(A) + i conj(B), with
+      // A = X[k] + conj(X[h - k]) and B = (X[k] - conj(X[h - k])) conj(w^k)
+      const flt x0 = re[0], xh = re[h];
+      zre[0] = x0 + xh;
+      zim[0] = x0 - xh;
+      combine(zre, zim, [](const complex_t& xk, const complex_t& xm, const complex_t& w,
+                           complex_t& zk, complex_t& zm) {
+        const complex_t a = xk + conj(xm), b = (xk - conj(xm)) * conj(w);
+        // i b
+        zk = a + complex_t(-b.im, b.re);
+        const complex_t cb = conj(b);
+        zm = conj(a) + complex_t(-cb.im, cb.re);
+      });
+      half.inverse(zre, zim);
+      interleave_output(zre, zim, x);
+    }
+
+   private:
+    //! re[k] and im[k] from x[2k] and x[2k + 1]
+    void deinterleave_input(const flt* x, flt* re, flt* im) const {
+      const i64 h = n / 2;
+      i64 k = 0;
+      for (; k + i64(V::step) <= h; k += V::step) {
+        V even, odd;
+        deinterleave(V(x + 2 * k), V(x + 2 * k + V::step), even, odd);
+        even.store(re + k);
+        odd.store(im + k);
+      }
+      for (; k < h; ++k) {
+        re[k] = x[2 * k];
+        im[k] = x[2 * k + 1];
+      }
+    }
+    //! x[2k] and x[2k + 1] from re[k] and im[k]
+    void interleave_output(const flt* re, const flt* im, flt* x) const {
+      const i64 h = n / 2;
+      i64 k = 0;
+      for (; k + i64(V::step) <= h; k += V::step) {
+        V lo, hi;
+        interleave(V(re + k), V(im + k), lo, hi);
+        lo.store(x + 2 * k);
+        hi.store(x + 2 * k + V::step);
+      }
+      for (; k < h; ++k) {
+        x[2 * k] = re[k];
+        x[2 * k + 1] = im[k];
+      }
+    }
+    //! f(value k, value h - k, w^k, out k, out h - k) in place for k in
+    //! [1, h / 2], a register at a time while the mirrored run stays clear
+    //! of the forward one
+    template <typename F>
+    void combine(flt* re, flt* im, F f) const {
+      const i64 h = n / 2, count = h / 2 + 1;
+      const flt* tre = twiddles.get();
+      const flt* tim = tre + count;
+      flt reverse_index[V::step];
+      SVL_FOR_RANGE(V::step) reverse_index[i] = flt(V::step - 1 - i);
+      const V reverse(reverse_index);
+      i64 k = 1;
+      for (; k + i64(V::step) <= h / 2; k += V::step) {
+        // The mirrored values h - k - step + 1 ... h - k, reversed
+        const i64 m = h - k - V::step + 1;
+        const complex_t zk(V(re + k), V(im + k));
+        const complex_t zm(lookup(V(re + m), reverse), lookup(V(im + m), reverse));
+        complex_t xk, xm;
+        f(zk, zm, complex_t(V(tre + k), V(tim + k)), xk, xm);
+        xk.re.store(re + k);
+        xk.im.store(im + k);
+        lookup(xm.re, reverse).store(re + m);
+        lookup(xm.im, reverse).store(im + m);
+      }
+      // One element at a time for the rest, in the lowest lane
+      for (; k <= h / 2; ++k) {
+        const complex_t zk{ V(re[k]), V(im[k]) }, zm{ V(re[h - k]), V(im[h - k]) };
+        complex_t xk, xm;
+        f(zk, zm, complex_t(V(tre[k]), V(tim[k])), xk, xm);
+        re[h - k] = xm.re[0];
+        im[h - k] = xm.im[0];
+        re[k] = xk.re[0];
+        im[k] = xk.im[0];
+      }
+    }
+  };
+
+  namespace detail {
+    //! The plan for n from a cache of plans of type Plan shared by all threads
+    template <typename Plan>
+    inline const Plan& cached_plan(i64 n) {
+      static std::mutex lock;
+      static std::map<i64, std::unique_ptr<Plan>> plans;
+      std::lock_guard<std::mutex> guard(lock);
+      std::unique_ptr<Plan>& plan = plans[n];
+      if (!plan) plan.reset(new Plan(n));
+      return *plan;
+    }
+  }
+
+  //! The cached plan for complex FFTs of n, made on first use
+  template <typename V = Vec8f>
+  inline const FFTPlan<V>& fft_plan(i64 n) {
+    return detail::cached_plan<FFTPlan<V>>(n);
+  }
+  //! The cached plan for real FFTs of n, made on first use
+  template <typename V = Vec8f>
+  inline const RealFFTPlan<V>& real_fft_plan(i64 n) {
+    return detail::cached_plan<RealFFTPlan<V>>(n);
+  }
+}
@@ -4,6 +4,10 @@
 
 struct Vector16f {
   VECTOR_NUMBER_SETUP(Vector16f, 16, Vector16b, flt, Vector8f);
+  //! Whether fma rounds once, as it does at every level but SSE
+  static const bool fused_fma = SVL_SIMD_LEVEL != SVL_SSE;
+  //! Unsigned 64 bit integers of the same width, for working on the bits
+  using bits_t = Vector8u64;
   
 #if SVL_SIMD_LEVEL < SVL_AVX512
   using intrinsic_t = struct { half_t v0_7, v8_f; };
@@ -155,6 +159,131 @@ struct Vector16f {
     _mm512_mask_storeu_ps(arr, (__mmask16)(1 << n) - 1, data);
 #endif
   }
+
+  // Half precision and bfloat16 storage
+  //! Load step IEEE half precision values and widen them to float
+  self_t& load_f16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_f16(arr);
+    data.v8_f.load_f16(arr + half_step);
+#else
+    data = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)arr));
+#endif
+    return *this;
+  }
+  //! Store the values as IEEE half precision, rounding to nearest even
+  void store_f16(u16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.store_f16(arr);
+    data.v8_f.store_f16(arr + half_step);
+#else
+    _mm256_storeu_si256((__m256i*)arr, _mm512_cvtps_ph(data, _MM_FROUND_TO_NEAREST_INT));
+#endif
+  }
+  //! Load step bfloat16 values and widen them to float
+  self_t& load_bf16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_bf16(arr);
+    data.v8_f.load_bf16(arr + half_step);
+#else
+    data = _mm512_castsi512_ps(_mm512_slli_epi32(
+        _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)arr)), 16));
+#endif
+    return *this;
+  }
+  //! Store the values as bfloat16, rounding to nearest even
+  void store_bf16(u16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.store_bf16(arr);
+    data.v8_f.store_bf16(arr + half_step);
+#else
+    __m512i bits = _mm512_castps_si512(data);
+    __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+    __m512i r = _mm512_srli_epi32(
+        _mm512_add_epi32(bits, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7fff))), 16);
+    // Rounding could carry a NaN into infinity, so truncate those instead
+    __m512i nan = _mm512_or_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(0x40));
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(data, data, _CMP_UNORD_Q), r, nan);
+    _mm256_storeu_si256((__m256i*)arr, _mm512_cvtepi32_epi16(r));
+#endif
+  }
+
+  // Integer storage
+  //! Load step unsigned bytes and convert them to float
+  self_t& load_u8(const u8* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_u8(arr);
+    data.v8_f.load_u8(arr + half_step);
+#else
+    data = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step signed bytes and convert them to float
+  self_t& load_i8(const i8* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_i8(arr);
+    data.v8_f.load_i8(arr + half_step);
+#else
+    data = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step unsigned 16 bit integers and convert them to float
+  self_t& load_u16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_u16(arr);
+    data.v8_f.load_u16(arr + half_step);
+#else
+    data = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step signed 16 bit integers and convert them to float
+  self_t& load_i16(const i16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_i16(arr);
+    data.v8_f.load_i16(arr + half_step);
+#else
+    data = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step 32 bit integers and convert them to float
+  self_t& load_i32(const i32* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.load_i32(arr);
+    data.v8_f.load_i32(arr + half_step);
+#else
+    data = _mm512_cvtepi32_ps(_mm512_loadu_si512(arr));
+#endif
+    return *this;
+  }
+  //! Store the values rounded to nearest even and saturated to [0, 255]. NaN
+  //! becomes 0
+  void store_u8_sat(u8* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.store_u8_sat(arr);
+    data.v8_f.store_u8_sat(arr + half_step);
+#else
+    __m512i v = _mm512_cvtps_epi32(
+        _mm512_min_ps(_mm512_max_ps(data, _mm512_setzero_ps()), SVL_CONSTANT(self_t, 255.f)));
+    _mm_storeu_si128((__m128i*)arr, _mm512_cvtepi32_epi8(v));
+#endif
+  }
+  //! Store the values rounded to nearest even and saturated to
+  //! [-32768, 32767]. NaN becomes -32768
+  void store_i16_sat(i16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_7.store_i16_sat(arr);
+    data.v8_f.store_i16_sat(arr + half_step);
+#else
+    __m512i v = _mm512_cvtps_epi32(
+        _mm512_min_ps(_mm512_max_ps(data, SVL_CONSTANT(self_t, -32768.f)),
+                      SVL_CONSTANT(self_t, 32767.f)));
+    _mm256_storeu_si256((__m256i*)arr, _mm512_cvtepi32_epi16(v));
+#endif
+  }
   
   // Access single value
   //! RO access to a single value
@@ -303,6 +432,8 @@ struct Vector16f {
 #if SVL_SIMD_LEVEL < SVL_AVX512
     return self_t(a.data.v0_7 / b.data.v0_7,
                   a.data.v8_f / b.data.v8_f);
+#elif defined(SVL_FAST_MATH)
+    return a * rcp_nr(b);
 #else
     return _mm512_div_ps(a, b);
 #endif
@@ -393,12 +524,54 @@ struct Vector16f {
     return _mm512_mask_blend_ps(c, b, a);
 #endif
   }
+  //! Elements table[index[i]], where index holds whole numbers
+  friend inline self_t gather(const scalar_t* table, const self_t& index) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(gather(table, index.data.v0_7), gather(table, index.data.v8_f));
+#else
+    return _mm512_i32gather_ps(_mm512_cvttps_epi32(index), table, 4);
+#endif
+  }
+  //! Elements table[index[i]] of a table held in a vector, where index
+  //! holds whole numbers in [0, step)
+  friend inline self_t lookup(const self_t& table, const self_t& index) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    // Look up in both halves of the table, keeping the one the index is in
+    auto pick = [&table](const half_t& i) {
+      const half_t middle = half_t(flt(half_step));
+      return blend(lookup(table.data.v8_f, max(i - middle, half_t::zeros())),
+                   lookup(table.data.v0_7, min(i, middle - 1.f)), i >= middle);
+    };
+    return self_t(pick(index.data.v0_7), pick(index.data.v8_f));
+#else
+    return _mm512_permutexvar_ps(_mm512_cvttps_epi32(index), table);
+#endif
+  }
+
   //! Returns the sum of all elements
   friend inline scalar_t horizontal_add(const self_t& a) {
 #if SVL_SIMD_LEVEL < SVL_AVX512
     return horizontal_add(a.data.v0_7) + horizontal_add(a.data.v8_f);
 #else
     return _mm512_reduce_add_ps(a);
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i]. The sums are
+  //! formed in log2(step) steps so may round differently to a running sum
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t lo = prefix_sum(a.data.v0_7);
+    return self_t(lo, prefix_sum(a.data.v8_f) + half_t(lo[half_step - 1]));
+#else
+    // Scan each 128 bit lane, then scan the lane totals and add those of the
+    // lanes below to each lane
+    const __m512i zero = _mm512_setzero_si512();
+    __m512 x = _mm512_add_ps(a, _mm512_castsi512_ps(_mm512_bslli_epi128(_mm512_castps_si512(a), 4)));
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_bslli_epi128(_mm512_castps_si512(x), 8)));
+    __m512 t = _mm512_permute_ps(x, 0xff);
+    t = _mm512_add_ps(t, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(t), zero, 12)));
+    t = _mm512_add_ps(t, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(t), zero, 8)));
+    return _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(t), zero, 12)));
 #endif
   }
   //! Find the maximum elements between two vectors
@@ -440,15 +613,96 @@ struct Vector16f {
 #endif
   }
   
+  //! Multiply add of a * b + c. Only fused from AVX2 upwards
+  friend inline self_t fma(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(fma(a.data.v0_7, b.data.v0_7, c.data.v0_7),
+                  fma(a.data.v8_f, b.data.v8_f, c.data.v8_f));
+#else
+    return _mm512_fmadd_ps(a, b, c);
+#endif
+  }
+  //! Negated multiply add of c - a * b. Only fused from AVX2 upwards
+  friend inline self_t fnma(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(fnma(a.data.v0_7, b.data.v0_7, c.data.v0_7),
+                  fnma(a.data.v8_f, b.data.v8_f, c.data.v8_f));
+#else
+    return _mm512_fnmadd_ps(a, b, c);
+#endif
+  }
+  
   // Special math functions
   //! Finds the square root of all elements in a
   friend inline self_t sqrt(const self_t& a) {
 #if SVL_SIMD_LEVEL < SVL_AVX512
     return self_t(sqrt(a.data.v0_7), sqrt(a.data.v8_f));
+#elif defined(SVL_FAST_MATH)
+    return blend(a, a * rsqrt_nr(a), (a == zeros()) | (a == SVL_CONSTANT(self_t, HUGE_VALF)));
 #else
     return _mm512_sqrt_ps(a);
 #endif
   }
+  //! Approximate reciprocal of all elements in x, relative error <= 1.5 * 2^-12
+  //! (2^-14 with AVX512). Exact in the scalar namespace
+  friend inline self_t rcp(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(rcp(x.data.v0_7), rcp(x.data.v8_f));
+#else
+    return _mm512_rcp14_ps(x);
+#endif
+  }
+  //! Reciprocal of all elements in x refined with one Newton-Raphson step,
+  //! relative error <= 2^-22. Gives NaN for zero or infinite x
+  friend inline self_t rcp_nr(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(rcp_nr(x.data.v0_7), rcp_nr(x.data.v8_f));
+#else
+    self_t r = rcp(x);
+    return fma(r, fnma(x, r, 1.f), r);
+#endif
+  }
+  //! Reciprocal of all elements in x refined with two Newton-Raphson steps,
+  //! relative error <= 2^-23. Gives NaN for zero or infinite x
+  friend inline self_t rcp_nr2(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(rcp_nr2(x.data.v0_7), rcp_nr2(x.data.v8_f));
+#else
+    self_t r = rcp_nr(x);
+    return fma(r, fnma(x, r, 1.f), r);
+#endif
+  }
+  //! Approximate reciprocal square root of all elements in x, relative error
+  //! <= 1.5 * 2^-12 (2^-14 with AVX512). Exact in the scalar namespace
+  friend inline self_t rsqrt(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(rsqrt(x.data.v0_7), rsqrt(x.data.v8_f));
+#else
+    return _mm512_rsqrt14_ps(x);
+#endif
+  }
+  //! Reciprocal square root of all elements in x refined with one
+  //! Newton-Raphson step, relative error <= 2^-21. Gives NaN for zero or
+  //! infinite x
+  friend inline self_t rsqrt_nr(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(rsqrt_nr(x.data.v0_7), rsqrt_nr(x.data.v8_f));
+#else
+    self_t r = rsqrt(x);
+    return fma(r * 0.5f, fnma(x * r, r, 1.f), r);
+#endif
+  }
+  //! Reciprocal square root of all elements in x refined with two
+  //! Newton-Raphson steps, relative error <= 2^-22.5. Gives NaN for zero or
+  //! infinite x
+  friend inline self_t rsqrt_nr2(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(rsqrt_nr2(x.data.v0_7), rsqrt_nr2(x.data.v8_f));
+#else
+    self_t r = rsqrt_nr(x);
+    return fma(r * 0.5f, fnma(x * r, r, 1.f), r);
+#endif
+  }
   
   //! Calculates the sine of all elements in x
   friend inline self_t sin(const self_t& x) {
@@ -517,6 +771,21 @@ struct Vector16f {
     return _mm512_abs_ps(x);
 #endif
   }
+  //! Magnitudes of x with the signs of y
+  friend inline self_t copysign(const self_t& x, const self_t& y) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(copysign(x.data.v0_7, y.data.v0_7), copysign(x.data.v8_f, y.data.v8_f));
+#else
+    // Bitwise select, sign bit ? y : x
+    const __m512i s = _mm512_castps_si512(constant<self_t, 0x80000000u>());
+    return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(s, _mm512_castps_si512(y),
+                                                         _mm512_castps_si512(x), 0xCA));
+#endif
+  }
+  //! 1 with the sign of x for non zero x. Zeros and NaNs are returned as is
+  friend inline self_t sign(const self_t& x) {
+    return blend(x, copysign(SVL_CONSTANT(self_t, 1.f), x), (x == zeros()) | isnan(x));
+  }
   
   //! Floor of the values of x
   friend inline self_t floor(const self_t& x) {
@@ -535,7 +804,7 @@ struct Vector16f {
 #endif
   }
   
-  //! Round the values of x
+  //! Round the values of x to the nearest integer, ties to even
   friend inline self_t round(const self_t& x) {
 #if SVL_SIMD_LEVEL < SVL_AVX512
     return self_t(round(x.data.v0_7), round(x.data.v8_f));
@@ -543,7 +812,363 @@ struct Vector16f {
     return _mm512_round_ps(x.data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
 #endif
   }
+  //! Round the values of x towards zero
+  friend inline self_t trunc(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(trunc(x.data.v0_7), trunc(x.data.v8_f));
+#else
+    return _mm512_roundscale_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#endif
+  }
+  //! Fractional part x - floor(x) of the values of x, in [0, 1). NaN for
+  //! infinite or NaN x
+  friend inline self_t fract(const self_t& x) {
+    return min(constant<self_t, 0x3F7FFFFFu>(), x - floor(x));
+  }
+  //! Remainder of x / y with the sign of x, exactly as std::fmod. NaN for
+  //! zero y or infinite x
+  friend inline self_t fmod(const self_t& x, const self_t& y) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(fmod(x.data.v0_7, y.data.v0_7), fmod(x.data.v8_f, y.data.v8_f));
+#else
+    // Take off whole multiples of y * 2^k, 20 bits of quotient at a time.
+    // Each step is exact as the fused remainder fits in a float. getexp
+    // already handles denormals
+    const self_t b = abs(y), eb = exponent(b);
+    self_t r = abs(x);
+    bool_t active = (r >= b) & (b > zeros()) & isfinite(r);
+    while (active.any()) {
+      const self_t bs = ldexp(b, max(exponent(r) - eb - 20.f, zeros()));
+      self_t rem = fnma(trunc(r / bs), bs, r);
+      rem = blend(rem + bs, rem, rem < zeros());
+      r = blend(rem, r, active);
+      active &= r >= b;
+    }
+    const bool_t invalid = (y == zeros()) | isinf(x) | isnan(y);
+    return blend(constant<self_t, 0x7FC00000u>(), copysign(r, x), invalid);
+#endif
+  }
+  //! IEEE remainder x - n * y, with n the nearest integer to x / y, ties to
+  //! even, exactly as std::remainder
+  friend inline self_t remainder(const self_t& x, const self_t& y) {
+    // Reduce into [0, 2|y|) then take off |y| up to twice. Each subtraction
+    // is exact as the operands are within a factor of two
+    const self_t p = abs(y);
+    self_t r = abs(fmod(x, p + p));
+    bool_t over = r + r > p;
+    r = blend(r - p, r, over);
+    r = blend(r - p, r, over & (r + r >= p));
+    return r * copysign(SVL_CONSTANT(self_t, 1.f), x);
+  }
   
+  // Exponent manipulation
+  //! Returns 2^n for all integer valued elements of n in [-126, 127]
+  friend inline self_t pow2n(const self_t& n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(pow2n(n.data.v0_7), pow2n(n.data.v8_f));
+#else
+    return _mm512_scalef_ps(SVL_CONSTANT(self_t, 1.f), n);
+#endif
+  }
+  //! Returns the exponent, floor(log2(|x|)), of all normal elements in x
+  friend inline self_t exponent(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(exponent(x.data.v0_7), exponent(x.data.v8_f));
+#else
+    return _mm512_getexp_ps(x);
+#endif
+  }
+  //! Returns the mantissa, in [1, 2), of all normal elements in x
+  friend inline self_t fraction(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(fraction(x.data.v0_7), fraction(x.data.v8_f));
+#else
+    return _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+#endif
+  }
+  //! Splits x into a mantissa, returned, with magnitude in [0.5, 1) and the
+  //! sign of x, and whole number exponents e with x = mantissa * 2^e. Zeros,
+  //! infinities and NaNs are returned as is with e = 0
+  friend inline self_t frexp(const self_t& x, self_t& e) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t e0_7, e8_f;
+    self_t m(frexp(x.data.v0_7, e0_7), frexp(x.data.v8_f, e8_f));
+    e = self_t(e0_7, e8_f);
+    return m;
+#else
+    // getexp and getmant handle denormals directly
+    const __mmask16 special = _mm512_fpclass_ps_mask(x, 0x9F);
+    e = _mm512_maskz_add_ps(_knot_mask16(special), _mm512_getexp_ps(x), SVL_CONSTANT(self_t, 1.f));
+    return _mm512_mask_getmant_ps(x, _knot_mask16(special), x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+#endif
+  }
+  //! x * 2^n for whole numbers n, without overflowing or underflowing before
+  //! the final result
+  friend inline self_t ldexp(const self_t& x, const self_t& n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(ldexp(x.data.v0_7, n.data.v0_7), ldexp(x.data.v8_f, n.data.v8_f));
+#else
+    return _mm512_scalef_ps(x, n);
+#endif
+  }
+
+  // Classification
+  //! Returns true for all elements of x that are NaN
+  friend inline bool_t isnan(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return bool_t(isnan(x.data.v0_7), isnan(x.data.v8_f));
+#else
+    return _mm512_fpclass_ps_mask(x, 0x81);
+#endif
+  }
+  //! Returns true for all elements of x that are positive or negative infinity
+  friend inline bool_t isinf(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return bool_t(isinf(x.data.v0_7), isinf(x.data.v8_f));
+#else
+    return _mm512_fpclass_ps_mask(x, 0x18);
+#endif
+  }
+  //! Returns true for all elements of x that are neither infinite nor NaN
+  friend inline bool_t isfinite(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return bool_t(isfinite(x.data.v0_7), isfinite(x.data.v8_f));
+#else
+    return _knot_mask16(_mm512_fpclass_ps_mask(x, 0x99));
+#endif
+  }
+  //! Returns true for all elements of x that are normal, so not zero,
+  //! denormal, infinite or NaN
+  friend inline bool_t isnormal(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return bool_t(isnormal(x.data.v0_7), isnormal(x.data.v8_f));
+#else
+    return _knot_mask16(_mm512_fpclass_ps_mask(x, 0xBF));
+#endif
+  }
+
+  // Complex pairs, elements 2k and 2k + 1 holding the real and imaginary
+  // parts of a complex number
+  //! Even elements copied over the odd ones after them, x0 x0 x2 x2 ...
+  friend inline self_t dup_even(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(dup_even(x.data.v0_7), dup_even(x.data.v8_f));
+#else
+    return _mm512_moveldup_ps(x);
+#endif
+  }
+  //! Odd elements copied over the even ones before them, x1 x1 x3 x3 ...
+  friend inline self_t dup_odd(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(dup_odd(x.data.v0_7), dup_odd(x.data.v8_f));
+#else
+    return _mm512_movehdup_ps(x);
+#endif
+  }
+  //! Neighbouring elements swapped, x1 x0 x3 x2 ...
+  friend inline self_t swap_pairs(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(swap_pairs(x.data.v0_7), swap_pairs(x.data.v8_f));
+#else
+    return _mm512_permute_ps(x, 0xB1);
+#endif
+  }
+  //! a * b - c in the even elements and a * b + c in the odd ones. Only
+  //! fused from AVX2 upwards
+  friend inline self_t fmaddsub(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(fmaddsub(a.data.v0_7, b.data.v0_7, c.data.v0_7),
+                  fmaddsub(a.data.v8_f, b.data.v8_f, c.data.v8_f));
+#else
+    return _mm512_fmaddsub_ps(a, b, c);
+#endif
+  }
+  //! Interleave the elements of a and b, lo = a0 b0 ... a7 b7 and
+  //! hi = a8 b8 ... af bf
+  friend inline void interleave(const self_t& a, const self_t& b, self_t& lo, self_t& hi) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t l0, l1, h0, h1;
+    interleave(a.data.v0_7, b.data.v0_7, l0, l1);
+    interleave(a.data.v8_f, b.data.v8_f, h0, h1);
+    lo = self_t(l0, l1);
+    hi = self_t(h0, h1);
+#else
+    // Indices 16 and up select from b
+    lo = _mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19,
+                                                     4, 20, 5, 21, 6, 22, 7, 23), b);
+    hi = _mm512_permutex2var_ps(a, _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27,
+                                                     12, 28, 13, 29, 14, 30, 15, 31), b);
+#endif
+  }
+  //! Split the elements of lo then hi into the even ones, lo0 lo2 ... hie,
+  //! and the odd ones, lo1 lo3 ... hif. The inverse of interleave
+  friend inline void deinterleave(const self_t& lo, const self_t& hi, self_t& even, self_t& odd) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t e0, e1, o0, o1;
+    deinterleave(lo.data.v0_7, lo.data.v8_f, e0, o0);
+    deinterleave(hi.data.v0_7, hi.data.v8_f, e1, o1);
+    even = self_t(e0, e1);
+    odd = self_t(o0, o1);
+#else
+    even = _mm512_permutex2var_ps(lo, _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14,
+                                                        16, 18, 20, 22, 24, 26, 28, 30), hi);
+    odd = _mm512_permutex2var_ps(lo, _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15,
+                                                       17, 19, 21, 23, 25, 27, 29, 31), hi);
+#endif
+  }
+
+  // Sliding windows
+  //! Elements S to 15 of a followed by the first S of b, the window S
+  //! elements along a then b, for S in [0, 16]
+  template <int S> static self_t align(const self_t& a, const self_t& b) {
+    static_assert(S >= 0 && S <= int(step), "The window must lie within a and b");
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    if constexpr (S < int(half_step))
+      return self_t(half_t::template align<S>(a.data.v0_7, a.data.v8_f),
+                    half_t::template align<S>(a.data.v8_f, b.data.v0_7));
+    else
+      return self_t(half_t::template align<S - int(half_step)>(a.data.v8_f, b.data.v0_7),
+                    half_t::template align<S - int(half_step)>(b.data.v0_7, b.data.v8_f));
+#else
+    if constexpr (S == int(step)) return b;
+    else
+      return _mm512_castsi512_ps(
+          _mm512_alignr_epi32(_mm512_castps_si512(b), _mm512_castps_si512(a), S));
+#endif
+  }
+
+  // Sorting networks
+#if SVL_SIMD_LEVEL >= SVL_AVX512
+  //! Elements of x swapped with those j lanes away
+  template <int j> static intrinsic_t partner(const intrinsic_t& x) {
+    if constexpr (j >= 4) return _mm512_shuffle_f32x4(x, x, j == 4 ? 0xB1 : 0x4E);
+    else return _mm512_permute_ps(x, j == 1 ? 0xB1 : 0x4E);
+  }
+  //! Elements of x in reverse order
+  static intrinsic_t reverse(const intrinsic_t& x) {
+    intrinsic_t r = _mm512_permute_ps(x, 0x1B);
+    return _mm512_shuffle_f32x4(r, r, 0x1B);
+  }
+  //! Compare each element with its partner j lanes away, keeping the larger
+  //! in the lanes set in hi and the smaller in the others
+  template <int j, int hi> static intrinsic_t exchange(const intrinsic_t& x) {
+    intrinsic_t p = partner<j>(x);
+    return _mm512_mask_blend_ps(__mmask16(hi), _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+  }
+  //! exchange on the keys k, moving the elements of v with them
+  template <int j, int hi> static void exchange(intrinsic_t& k, intrinsic_t& v) {
+    intrinsic_t p = partner<j>(k), q = partner<j>(v);
+    __mmask16 swap = (_mm512_cmp_ps_mask(p, k, _CMP_LT_OQ) & __mmask16(~hi)) |
+                     (_mm512_cmp_ps_mask(p, k, _CMP_GT_OQ) & __mmask16(hi));
+    k = _mm512_mask_blend_ps(swap, k, p);
+    v = _mm512_mask_blend_ps(swap, v, q);
+  }
+  //! Lanes where a < b
+  static __mmask16 less(const intrinsic_t& a, const intrinsic_t& b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+  }
+  //! Elements of b where mask is set, else of a
+  static intrinsic_t select(const intrinsic_t& a, const intrinsic_t& b, __mmask16 mask) {
+    return _mm512_mask_blend_ps(mask, a, b);
+  }
+#endif
+  //! Sort the elements into ascending order. NaNs are not supported
+  friend inline self_t sort(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t lo = sort(a.data.v0_7), hi = sort(a.data.v8_f);
+    merge_sorted(lo, hi);
+    return self_t(lo, hi);
+#else
+    intrinsic_t x = a;
+    x = exchange<1, 0x6666>(x);
+    x = exchange<2, 0x3C3C>(x);
+    x = exchange<1, 0x5A5A>(x);
+    x = exchange<4, 0xFF0>(x);
+    x = exchange<2, 0x33CC>(x);
+    x = exchange<1, 0x55AA>(x);
+    x = exchange<8, 0xFF00>(x);
+    x = exchange<4, 0xF0F0>(x);
+    x = exchange<2, 0xCCCC>(x);
+    x = exchange<1, 0xAAAA>(x);
+    return x;
+#endif
+  }
+  //! Sort keys into ascending order, moving the elements of values (which may
+  //! hold any bit patterns, e.g. indices) with them. NaN keys are not supported
+  friend inline void sort(self_t& keys, self_t& values) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    sort(keys.data.v0_7, values.data.v0_7);
+    sort(keys.data.v8_f, values.data.v8_f);
+    merge_sorted(keys.data.v0_7, values.data.v0_7, keys.data.v8_f, values.data.v8_f);
+#else
+    exchange<1, 0x6666>(keys.data, values.data);
+    exchange<2, 0x3C3C>(keys.data, values.data);
+    exchange<1, 0x5A5A>(keys.data, values.data);
+    exchange<4, 0xFF0>(keys.data, values.data);
+    exchange<2, 0x33CC>(keys.data, values.data);
+    exchange<1, 0x55AA>(keys.data, values.data);
+    exchange<8, 0xFF00>(keys.data, values.data);
+    exchange<4, 0xF0F0>(keys.data, values.data);
+    exchange<2, 0xCCCC>(keys.data, values.data);
+    exchange<1, 0xAAAA>(keys.data, values.data);
+#endif
+  }
+  //! Merge two sorted vectors, leaving the lowest step elements in a and the
+  //! highest in b, both sorted
+  friend inline void merge_sorted(self_t& a, self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    // Odd-even merge of the sorted halves
+    merge_sorted(a.data.v0_7, b.data.v0_7);
+    merge_sorted(a.data.v8_f, b.data.v8_f);
+    merge_sorted(b.data.v0_7, a.data.v8_f);
+    std::swap(a.data.v8_f, b.data.v0_7);
+#else
+    // Reversing b makes a, b bitonic, so splitting into the lane wise minima
+    // and maxima then cleaning up each half sorts them
+    intrinsic_t r = reverse(b);
+    intrinsic_t lo = min(a, self_t(r)), hi = max(a, self_t(r));
+    lo = exchange<8, 0xFF00>(lo);
+    lo = exchange<4, 0xF0F0>(lo);
+    lo = exchange<2, 0xCCCC>(lo);
+    lo = exchange<1, 0xAAAA>(lo);
+    hi = exchange<8, 0xFF00>(hi);
+    hi = exchange<4, 0xF0F0>(hi);
+    hi = exchange<2, 0xCCCC>(hi);
+    hi = exchange<1, 0xAAAA>(hi);
+    a = lo;
+    b = hi;
+#endif
+  }
+  //! Merge two sorted vectors of keys, leaving the lowest step keys in ka and
+  //! the highest in kb, and moving the elements of va and vb with them
+  friend inline void merge_sorted(self_t& ka, self_t& va, self_t& kb, self_t& vb) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    // Odd-even merge of the sorted halves
+    merge_sorted(ka.data.v0_7, va.data.v0_7, kb.data.v0_7, vb.data.v0_7);
+    merge_sorted(ka.data.v8_f, va.data.v8_f, kb.data.v8_f, vb.data.v8_f);
+    merge_sorted(kb.data.v0_7, vb.data.v0_7, ka.data.v8_f, va.data.v8_f);
+    std::swap(ka.data.v8_f, kb.data.v0_7);
+    std::swap(va.data.v8_f, vb.data.v0_7);
+#else
+    // As for keys alone, splitting on the comparison of the keys
+    intrinsic_t rk = reverse(kb), rv = reverse(vb);
+    auto lower = less(rk, ka);
+    intrinsic_t lk = select(ka, rk, lower), lv = select(va, rv, lower);
+    intrinsic_t hk = select(rk, ka, lower), hv = select(rv, va, lower);
+    exchange<8, 0xFF00>(lk, lv);
+    exchange<4, 0xF0F0>(lk, lv);
+    exchange<2, 0xCCCC>(lk, lv);
+    exchange<1, 0xAAAA>(lk, lv);
+    exchange<8, 0xFF00>(hk, hv);
+    exchange<4, 0xF0F0>(hk, hv);
+    exchange<2, 0xCCCC>(hk, hv);
+    exchange<1, 0xAAAA>(hk, hv);
+    ka = lk;
+    va = lv;
+    kb = hk;
+    vb = hv;
+#endif
+  }
 };
 
 
@@ -4,6 +4,10 @@
 
 struct Vector4f {
   VECTOR_NUMBER_SETUP(Vector4f, 4, Vector4b, flt, std::nullptr_t);
+  //! Whether fma rounds once, as it does at every level but SSE
+  static const bool fused_fma = SVL_SIMD_LEVEL != SVL_SSE;
+  //! Unsigned 64 bit integers of the same width, for working on the bits
+  using bits_t = Vector2u64;
   
 #if SVL_SIMD_LEVEL < SVL_SSE
   using intrinsic_t = struct { scalar_t v0, v1, v2, v3; };
@@ -158,6 +162,145 @@ struct Vector4f {
     }
 #endif
   }
+
+  // Half precision and bfloat16 storage
+  //! Load step IEEE half precision values and widen them to float
+  self_t& load_f16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    scalar_t tmp[step];
+    SVL_FOR_RANGE(step) tmp[i] = f16_to_float(arr[i]);
+    return load(tmp);
+#else
+    data = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)arr));
+    return *this;
+#endif
+  }
+  //! Store the values as IEEE half precision, rounding to nearest even
+  void store_f16(u16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    scalar_t tmp[step];
+    store(tmp);
+    SVL_FOR_RANGE(step) arr[i] = float_to_f16(tmp[i]);
+#else
+    _mm_storel_epi64((__m128i*)arr, _mm_cvtps_ph(data, _MM_FROUND_TO_NEAREST_INT));
+#endif
+  }
+  //! Load step bfloat16 values and widen them to float
+  self_t& load_bf16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    SVL_FOR_RANGE(step) assign(bf16_to_float(arr[i]), i);
+#else
+    data = _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(),
+                                               _mm_loadl_epi64((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Store the values as bfloat16, rounding to nearest even
+  void store_bf16(u16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    store(tmp);
+    SVL_FOR_RANGE(step) arr[i] = float_to_bf16(tmp[i]);
+#else
+    __m128i bits = _mm_castps_si128(data);
+    __m128i lsb = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+    __m128i r = _mm_srli_epi32(_mm_add_epi32(bits, _mm_add_epi32(lsb, _mm_set1_epi32(0x7fff))), 16);
+    // Rounding could carry a NaN into infinity, so truncate those instead
+    __m128i nan = _mm_or_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x40));
+    r = _mm_blendv_epi8(r, nan, _mm_castps_si128(_mm_cmpunord_ps(data, data)));
+    _mm_storel_epi64((__m128i*)arr, _mm_packus_epi32(r, r));
+#endif
+  }
+
+  // Integer storage
+  //! Load step unsigned bytes and convert them to float
+  self_t& load_u8(const u8* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    SVL_FOR_RANGE(step) tmp[i] = scalar_t(arr[i]);
+    return load(tmp);
+#else
+    i32 bytes;
+    memcpy(&bytes, arr, sizeof(bytes));
+    data = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)));
+    return *this;
+#endif
+  }
+  //! Load step signed bytes and convert them to float
+  self_t& load_i8(const i8* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    SVL_FOR_RANGE(step) tmp[i] = scalar_t(arr[i]);
+    return load(tmp);
+#else
+    i32 bytes;
+    memcpy(&bytes, arr, sizeof(bytes));
+    data = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(bytes)));
+    return *this;
+#endif
+  }
+  //! Load step unsigned 16 bit integers and convert them to float
+  self_t& load_u16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    SVL_FOR_RANGE(step) tmp[i] = scalar_t(arr[i]);
+    return load(tmp);
+#else
+    data = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)arr)));
+    return *this;
+#endif
+  }
+  //! Load step signed 16 bit integers and convert them to float
+  self_t& load_i16(const i16* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    SVL_FOR_RANGE(step) tmp[i] = scalar_t(arr[i]);
+    return load(tmp);
+#else
+    data = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)arr)));
+    return *this;
+#endif
+  }
+  //! Load step 32 bit integers and convert them to float
+  self_t& load_i32(const i32* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    SVL_FOR_RANGE(step) tmp[i] = scalar_t(arr[i]);
+    return load(tmp);
+#else
+    data = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)arr));
+    return *this;
+#endif
+  }
+  //! Store the values rounded to nearest even and saturated to [0, 255]. NaN
+  //! becomes 0
+  void store_u8_sat(u8* arr) const {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    store(tmp);
+    SVL_FOR_RANGE(step) arr[i] = u8(std::nearbyint(SVL_MIN(SVL_MAX(tmp[i], 0.f), 255.f)));
+#else
+    __m128i v = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(data, _mm_setzero_ps()),
+                                           SVL_CONSTANT(self_t, 255.f)));
+    v = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+    i32 bytes = _mm_cvtsi128_si32(v);
+    memcpy(arr, &bytes, sizeof(bytes));
+#endif
+  }
+  //! Store the values rounded to nearest even and saturated to
+  //! [-32768, 32767]. NaN becomes -32768
+  void store_i16_sat(i16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t tmp[step];
+    store(tmp);
+    SVL_FOR_RANGE(step)
+      arr[i] = i16(std::nearbyint(SVL_MIN(SVL_MAX(tmp[i], -32768.f), 32767.f)));
+#else
+    __m128i v = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(data, SVL_CONSTANT(self_t, -32768.f)),
+                                           SVL_CONSTANT(self_t, 32767.f)));
+    _mm_storel_epi64((__m128i*)arr, _mm_packs_epi32(v, v));
+#endif
+  }
   
   // Access single value
   //! RO access to a single value
@@ -316,6 +459,8 @@ struct Vector4f {
                   a.data.v1 / b.data.v1,
                   a.data.v2 / b.data.v2,
                   a.data.v3 / b.data.v3);
+#elif defined(SVL_FAST_MATH)
+    return a * rcp_nr(b);
 #else
     return _mm_div_ps(a, b);
 #endif
@@ -420,6 +565,27 @@ struct Vector4f {
     return _mm_blendv_ps(b, a, _mm_castsi128_ps(c));
 #endif
   }
+  //! Elements table[index[i]], where index holds whole numbers
+  friend inline self_t gather(const scalar_t* table, const self_t& index) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(table[i64(index[0])], table[i64(index[1])],
+                  table[i64(index[2])], table[i64(index[3])]);
+#else
+    return _mm_i32gather_ps(table, _mm_cvttps_epi32(index), 4);
+#endif
+  }
+  //! Elements table[index[i]] of a table held in a vector, where index
+  //! holds whole numbers in [0, step)
+  friend inline self_t lookup(const self_t& table, const self_t& index) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    scalar_t t[step];
+    table.store(t);
+    return gather(t, index);
+#else
+    return _mm_permutevar_ps(table, _mm_cvttps_epi32(index));
+#endif
+  }
+
   //! Returns the sum of all elements
   friend inline scalar_t horizontal_add(const self_t& a) {
 #if SVL_SIMD_LEVEL < SVL_SSE
@@ -427,6 +593,20 @@ struct Vector4f {
 #else
     intrinsic_t tmp = _mm_hadd_ps(a, a);
     return self_t(_mm_hadd_ps(tmp, tmp))[0];
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i]. The sums are
+  //! formed in log2(step) steps so may round differently to a running sum
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r = a;
+    r.data.v1 += r.data.v0;
+    r.data.v2 += r.data.v1;
+    r.data.v3 += r.data.v2;
+    return r;
+#else
+    __m128 x = _mm_add_ps(a, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(a), 4)));
+    return _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
 #endif
   }
   //! Find the maximum elements between two vectors
@@ -459,7 +639,33 @@ struct Vector4f {
   friend inline scalar_t horizontal_min(const self_t& a) {
     return SVL_MIN(SVL_MIN(a[0], a[1]), SVL_MIN(a[2], a[3]));
   }
-  
+  //! Multiply add of a * b + c. Only fused from AVX2 upwards
+  friend inline self_t fma(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(fma(a.data.v0, b.data.v0, c.data.v0),
+                  fma(a.data.v1, b.data.v1, c.data.v1),
+                  fma(a.data.v2, b.data.v2, c.data.v2),
+                  fma(a.data.v3, b.data.v3, c.data.v3));
+#elif SVL_SIMD_LEVEL < SVL_AVX2
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#else
+    return _mm_fmadd_ps(a, b, c);
+#endif
+  }
+  //! Negated multiply add of c - a * b. Only fused from AVX2 upwards
+  friend inline self_t fnma(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(fma(-a.data.v0, b.data.v0, c.data.v0),
+                  fma(-a.data.v1, b.data.v1, c.data.v1),
+                  fma(-a.data.v2, b.data.v2, c.data.v2),
+                  fma(-a.data.v3, b.data.v3, c.data.v3));
+#elif SVL_SIMD_LEVEL < SVL_AVX2
+    return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#else
+    return _mm_fnmadd_ps(a, b, c);
+#endif
+  }
+
   // Special math functions
   //! Finds the square root of all elements in a
   friend inline self_t sqrt(const self_t& a) {
@@ -468,10 +674,74 @@ struct Vector4f {
                   sqrt(a.data.v1),
                   sqrt(a.data.v2),
                   sqrt(a.data.v3));
+#elif defined(SVL_FAST_MATH)
+    return blend(a, a * rsqrt_nr(a), (a == zeros()) | (a == SVL_CONSTANT(self_t, HUGE_VALF)));
 #else
     return _mm_sqrt_ps(a);
 #endif
   }
+  //! Approximate reciprocal of all elements in x, relative error <= 1.5 * 2^-12.
+  //! Exact in the scalar namespace
+  friend inline self_t rcp(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(1.f / x.data.v0, 1.f / x.data.v1,
+                  1.f / x.data.v2, 1.f / x.data.v3);
+#else
+    return _mm_rcp_ps(x);
+#endif
+  }
+  //! Reciprocal of all elements in x refined with one Newton-Raphson step,
+  //! relative error <= 2^-22. Gives NaN for zero or infinite x
+  friend inline self_t rcp_nr(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return rcp(x);
+#else
+    self_t r = rcp(x);
+    return fma(r, fnma(x, r, 1.f), r);
+#endif
+  }
+  //! Reciprocal of all elements in x refined with two Newton-Raphson steps,
+  //! relative error <= 2^-23. Gives NaN for zero or infinite x
+  friend inline self_t rcp_nr2(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return rcp(x);
+#else
+    self_t r = rcp_nr(x);
+    return fma(r, fnma(x, r, 1.f), r);
+#endif
+  }
+  //! Approximate reciprocal square root of all elements in x, relative error
+  //! <= 1.5 * 2^-12. Exact in the scalar namespace
+  friend inline self_t rsqrt(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(1.f / sqrt(x.data.v0), 1.f / sqrt(x.data.v1),
+                  1.f / sqrt(x.data.v2), 1.f / sqrt(x.data.v3));
+#else
+    return _mm_rsqrt_ps(x);
+#endif
+  }
+  //! Reciprocal square root of all elements in x refined with one
+  //! Newton-Raphson step, relative error <= 2^-21. Gives NaN for zero or
+  //! infinite x
+  friend inline self_t rsqrt_nr(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return rsqrt(x);
+#else
+    self_t r = rsqrt(x);
+    return fma(r * 0.5f, fnma(x * r, r, 1.f), r);
+#endif
+  }
+  //! Reciprocal square root of all elements in x refined with two
+  //! Newton-Raphson steps, relative error <= 2^-22.5. Gives NaN for zero or
+  //! infinite x
+  friend inline self_t rsqrt_nr2(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return rsqrt(x);
+#else
+    self_t r = rsqrt_nr(x);
+    return fma(r * 0.5f, fnma(x * r, r, 1.f), r);
+#endif
+  }
   
   //! Calculates the sine of all elements in x
   friend inline self_t sin(const self_t& x) {
@@ -572,11 +842,24 @@ struct Vector4f {
     return self_t(fabs(x.data.v0), fabs(x.data.v1),
                   fabs(x.data.v2), fabs(x.data.v3));
 #else
-    __m128i mask = _mm_set_epi32(0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF);
-    return _mm_and_ps(_mm_castsi128_ps(mask), x.data);
+    return _mm_and_ps(constant<self_t, 0x7FFFFFFFu>(), x.data);
 #endif
   }
-  
+  //! Magnitudes of x with the signs of y
+  friend inline self_t copysign(const self_t& x, const self_t& y) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(copysign(x.data.v0, y.data.v0), copysign(x.data.v1, y.data.v1),
+                  copysign(x.data.v2, y.data.v2), copysign(x.data.v3, y.data.v3));
+#else
+    const intrinsic_t s = constant<self_t, 0x80000000u>();
+    return _mm_or_ps(_mm_andnot_ps(s, x), _mm_and_ps(s, y));
+#endif
+  }
+  //! 1 with the sign of x for non zero x. Zeros and NaNs are returned as is
+  friend inline self_t sign(const self_t& x) {
+    return blend(x, copysign(SVL_CONSTANT(self_t, 1.f), x), (x == zeros()) | isnan(x));
+  }
+
   //! Floor of the values of x
   friend inline self_t floor(const self_t& x) {
 #if SVL_SIMD_LEVEL < SVL_SSE
@@ -596,13 +879,401 @@ struct Vector4f {
 #endif
   }
   
-  //! Round the values of x
+  //! Round the values of x to the nearest integer, ties to even
   friend inline self_t round(const self_t& x) {
 #if SVL_SIMD_LEVEL < SVL_SSE
-    return self_t(round(x.data.v0), round(x.data.v1),
-                  round(x.data.v2), round(x.data.v3));
+    return self_t(nearbyint(x.data.v0), nearbyint(x.data.v1),
+                  nearbyint(x.data.v2), nearbyint(x.data.v3));
 #else
     return _mm_round_ps(x.data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#endif
+  }
+  //! Round the values of x towards zero
+  friend inline self_t trunc(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(trunc(x.data.v0), trunc(x.data.v1),
+                  trunc(x.data.v2), trunc(x.data.v3));
+#else
+    return _mm_round_ps(x.data, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#endif
+  }
+  //! Fractional part x - floor(x) of the values of x, in [0, 1). NaN for
+  //! infinite or NaN x
+  friend inline self_t fract(const self_t& x) {
+    return min(constant<self_t, 0x3F7FFFFFu>(), x - floor(x));
+  }
+  //! Remainder of x / y with the sign of x, exactly as std::fmod. NaN for
+  //! zero y or infinite x. Only vectorised where fma is fused
+  friend inline self_t fmod(const self_t& x, const self_t& y) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(fmod(x.data.v0, y.data.v0), fmod(x.data.v1, y.data.v1),
+                  fmod(x.data.v2, y.data.v2), fmod(x.data.v3, y.data.v3));
+#elif SVL_SIMD_LEVEL < SVL_AVX2
+    self_t r;
+    SVL_FOR_RANGE(step) r.assign(fmod(x[i], y[i]), i);
+    return r;
+#else
+    // Take off whole multiples of y * 2^k, 20 bits of quotient at a time.
+    // Each step is exact as the fused remainder fits in a float
+    const self_t tiny = constant<self_t, 0x00800000u>(), up = SVL_CONSTANT(self_t, 16777216.f);
+    const self_t b = abs(y);
+    const self_t eb = blend(exponent(b * up) - 24.f, exponent(b), b < tiny);
+    self_t r = abs(x);
+    bool_t active = (r >= b) & (b > zeros()) & isfinite(r);
+    while (active.any()) {
+      const self_t er = blend(exponent(r * up) - 24.f, exponent(r), r < tiny);
+      const self_t bs = ldexp(b, max(er - eb - 20.f, zeros()));
+      self_t rem = fnma(trunc(r / bs), bs, r);
+      rem = blend(rem + bs, rem, rem < zeros());
+      r = blend(rem, r, active);
+      active &= r >= b;
+    }
+    const bool_t invalid = (y == zeros()) | isinf(x) | isnan(y);
+    return blend(constant<self_t, 0x7FC00000u>(), copysign(r, x), invalid);
+#endif
+  }
+  //! IEEE remainder x - n * y, with n the nearest integer to x / y, ties to
+  //! even, exactly as std::remainder
+  friend inline self_t remainder(const self_t& x, const self_t& y) {
+    // Reduce into [0, 2|y|) then take off |y| up to twice. Each subtraction
+    // is exact as the operands are within a factor of two
+    const self_t p = abs(y);
+    self_t r = abs(fmod(x, p + p));
+    bool_t over = r + r > p;
+    r = blend(r - p, r, over);
+    r = blend(r - p, r, over & (r + r >= p));
+    return r * copysign(SVL_CONSTANT(self_t, 1.f), x);
+  }
+
+  // Exponent manipulation
+  //! Returns 2^n for all integer valued elements of n in [-126, 127]
+  friend inline self_t pow2n(const self_t& n) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(ldexp(1.f, int(n.data.v0)), ldexp(1.f, int(n.data.v1)),
+                  ldexp(1.f, int(n.data.v2)), ldexp(1.f, int(n.data.v3)));
+#else
+    __m128i e = _mm_add_epi32(_mm_cvtps_epi32(n), _mm_castps_si128(constant<self_t, 127u>()));
+    return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+#endif
+  }
+  //! Returns the exponent, floor(log2(|x|)), of all normal elements in x
+  friend inline self_t exponent(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    // Same bit extraction as the SIMD versions, so zeros, denormals,
+    // infinities and NaNs give the same values
+    u32 bits[step];
+    scalar_t e[step];
+    memcpy(bits, &x.data, sizeof(bits));
+    SVL_FOR_RANGE(step) e[i] = scalar_t(i32((bits[i] >> 23) & 0xFFu) - 127);
+    return self_t(e);
+#else
+    __m128i e = _mm_srli_epi32(_mm_castps_si128(x), 23);
+    e = _mm_and_si128(e, _mm_castps_si128(constant<self_t, 0xFFu>()));
+    return _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_castps_si128(constant<self_t, 127u>())));
+#endif
+  }
+  //! Returns the mantissa, in [1, 2), of all normal elements in x
+  friend inline self_t fraction(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    u32 bits[step];
+    memcpy(bits, &x.data, sizeof(bits));
+    SVL_FOR_RANGE(step) bits[i] = (bits[i] & 0x007FFFFFu) | 0x3F800000u;
+    self_t r;
+    memcpy(&r.data, bits, sizeof(bits));
+    return r;
+#else
+    __m128i m = _mm_and_si128(_mm_castps_si128(x), _mm_castps_si128(constant<self_t, 0x007FFFFFu>()));
+    return _mm_castsi128_ps(_mm_or_si128(m, _mm_castps_si128(constant<self_t, 0x3F800000u>())));
+#endif
+  }
+  //! Splits x into a mantissa, returned, with magnitude in [0.5, 1) and the
+  //! sign of x, and whole number exponents e with x = mantissa * 2^e. Zeros,
+  //! infinities and NaNs are returned as is with e = 0
+  friend inline self_t frexp(const self_t& x, self_t& e) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    int e0, e1, e2, e3;
+    self_t m(frexp(x.data.v0, &e0), frexp(x.data.v1, &e1),
+             frexp(x.data.v2, &e2), frexp(x.data.v3, &e3));
+    e = self_t(scalar_t(e0), scalar_t(e1), scalar_t(e2), scalar_t(e3));
+    return m;
+#else
+    // Denormals are scaled up by 2^24 to make them normal
+    const bool_t small = abs(x) < constant<self_t, 0x00800000u>();
+    const intrinsic_t s = blend(x * SVL_CONSTANT(self_t, 16777216.f), x, small);
+    __m128i bits = _mm_castps_si128(s);
+    __m128i ex = _mm_and_si128(_mm_srli_epi32(bits, 23), _mm_castps_si128(constant<self_t, 0xFFu>()));
+    const bool_t special = (x == zeros()) | ~isfinite(x);
+    const self_t unbiased = _mm_cvtepi32_ps(_mm_sub_epi32(ex, _mm_castps_si128(constant<self_t, 126u>())));
+    e = blend(zeros(), unbiased - blend(SVL_CONSTANT(self_t, 24.f), zeros(), small), special);
+    bits = _mm_and_si128(bits, _mm_castps_si128(constant<self_t, 0x807FFFFFu>()));
+    return blend(x, _mm_castsi128_ps(_mm_or_si128(bits, _mm_castps_si128(constant<self_t, 0x3F000000u>()))), special);
+#endif
+  }
+  //! x * 2^n for whole numbers n, without overflowing or underflowing before
+  //! the final result
+  friend inline self_t ldexp(const self_t& x, const self_t& n) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(ldexp(x.data.v0, int(SVL_CLAMP(-400.f, n.data.v0, 400.f))),
+                  ldexp(x.data.v1, int(SVL_CLAMP(-400.f, n.data.v1, 400.f))),
+                  ldexp(x.data.v2, int(SVL_CLAMP(-400.f, n.data.v2, 400.f))),
+                  ldexp(x.data.v3, int(SVL_CLAMP(-400.f, n.data.v3, 400.f))));
+#else
+    // Scale by at most 2^127 or 2^-102 twice, then by the rest clamped to the
+    // range of pow2n, as musl's scalbnf does
+    const self_t hi = SVL_CONSTANT(self_t, 127.f), lo = SVL_CONSTANT(self_t, -126.f);
+    const self_t down = SVL_CONSTANT(self_t, -102.f);
+    self_t r = x, k = n;
+    for (int j = 0; j < 2; ++j) {
+      const self_t s = blend(hi, blend(down, zeros(), k < lo), k > hi);
+      r *= pow2n(s);
+      k -= s;
+    }
+    return r * pow2n(min(max(k, lo), hi));
+#endif
+  }
+
+  // Classification
+  //! Returns true for all elements of x that are NaN
+  friend inline bool_t isnan(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return bool_t(std::isnan(x.data.v0), std::isnan(x.data.v1),
+                  std::isnan(x.data.v2), std::isnan(x.data.v3));
+#else
+    return _mm_castps_si128(_mm_cmpunord_ps(x, x));
+#endif
+  }
+  //! Returns true for all elements of x that are positive or negative infinity
+  friend inline bool_t isinf(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return bool_t(std::isinf(x.data.v0), std::isinf(x.data.v1),
+                  std::isinf(x.data.v2), std::isinf(x.data.v3));
+#else
+    return _mm_castps_si128(_mm_cmpeq_ps(abs(x), constant<self_t, 0x7F800000u>()));
+#endif
+  }
+  //! Returns true for all elements of x that are neither infinite nor NaN
+  friend inline bool_t isfinite(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return bool_t(std::isfinite(x.data.v0), std::isfinite(x.data.v1),
+                  std::isfinite(x.data.v2), std::isfinite(x.data.v3));
+#else
+    return _mm_castps_si128(_mm_cmplt_ps(abs(x), constant<self_t, 0x7F800000u>()));
+#endif
+  }
+  //! Returns true for all elements of x that are normal, so not zero,
+  //! denormal, infinite or NaN
+  friend inline bool_t isnormal(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return bool_t(std::isnormal(x.data.v0), std::isnormal(x.data.v1),
+                  std::isnormal(x.data.v2), std::isnormal(x.data.v3));
+#else
+    const intrinsic_t a = abs(x);
+    return _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(a, constant<self_t, 0x00800000u>()),
+                                       _mm_cmplt_ps(a, constant<self_t, 0x7F800000u>())));
+#endif
+  }
+
+  // Complex pairs, elements 2k and 2k + 1 holding the real and imaginary
+  // parts of a complex number
+  //! Even elements copied over the odd ones after them, x0 x0 x2 x2
+  friend inline self_t dup_even(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(x.data.v0, x.data.v0, x.data.v2, x.data.v2);
+#else
+    return _mm_moveldup_ps(x);
+#endif
+  }
+  //! Odd elements copied over the even ones before them, x1 x1 x3 x3
+  friend inline self_t dup_odd(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(x.data.v1, x.data.v1, x.data.v3, x.data.v3);
+#else
+    return _mm_movehdup_ps(x);
+#endif
+  }
+  //! Neighbouring elements swapped, x1 x0 x3 x2
+  friend inline self_t swap_pairs(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(x.data.v1, x.data.v0, x.data.v3, x.data.v2);
+#else
+    return _mm_shuffle_ps(x, x, 0xB1);
+#endif
+  }
+  //! a * b - c in the even elements and a * b + c in the odd ones. Only
+  //! fused from AVX2 upwards
+  friend inline self_t fmaddsub(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return self_t(fma(a.data.v0, b.data.v0, -c.data.v0), fma(a.data.v1, b.data.v1, c.data.v1),
+                  fma(a.data.v2, b.data.v2, -c.data.v2), fma(a.data.v3, b.data.v3, c.data.v3));
+#elif SVL_SIMD_LEVEL < SVL_AVX2
+    return _mm_addsub_ps(_mm_mul_ps(a, b), c);
+#else
+    return _mm_fmaddsub_ps(a, b, c);
+#endif
+  }
+  //! Interleave the elements of a and b, lo = a0 b0 a1 b1 and hi = a2 b2 a3 b3
+  friend inline void interleave(const self_t& a, const self_t& b, self_t& lo, self_t& hi) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    lo = self_t(a.data.v0, b.data.v0, a.data.v1, b.data.v1);
+    hi = self_t(a.data.v2, b.data.v2, a.data.v3, b.data.v3);
+#else
+    lo = _mm_unpacklo_ps(a, b);
+    hi = _mm_unpackhi_ps(a, b);
+#endif
+  }
+  //! Split the elements of lo then hi into the even ones, lo0 lo2 hi0 hi2,
+  //! and the odd ones, lo1 lo3 hi1 hi3. The inverse of interleave
+  friend inline void deinterleave(const self_t& lo, const self_t& hi, self_t& even, self_t& odd) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    even = self_t(lo.data.v0, lo.data.v2, hi.data.v0, hi.data.v2);
+    odd = self_t(lo.data.v1, lo.data.v3, hi.data.v1, hi.data.v3);
+#else
+    even = _mm_shuffle_ps(lo, hi, 0x88);
+    odd = _mm_shuffle_ps(lo, hi, 0xDD);
+#endif
+  }
+
+  // Sliding windows
+  //! Elements S to 3 of a followed by the first S of b, the window S
+  //! elements along a then b, for S in [0, 4]
+  template <int S> static self_t align(const self_t& a, const self_t& b) {
+    static_assert(S >= 0 && S <= int(step), "The window must lie within a and b");
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t t[2 * step];
+    a.store(t);
+    b.store(t + step);
+    return self_t(t + S);
+#else
+    if constexpr (S == 0) return a;
+    else if constexpr (S == int(step)) return b;
+    else return _mm_castsi128_ps(_mm_alignr_epi8(_mm_castps_si128(b), _mm_castps_si128(a), 4 * S));
+#endif
+  }
+
+  // Sorting networks
+#if SVL_SIMD_LEVEL >= SVL_SSE
+  //! Elements of x swapped with those j lanes away
+  template <int j> static intrinsic_t partner(const intrinsic_t& x) {
+    return _mm_shuffle_ps(x, x, j == 1 ? 0xB1 : 0x4E);
+  }
+  //! Elements of x in reverse order
+  static intrinsic_t reverse(const intrinsic_t& x) { return _mm_shuffle_ps(x, x, 0x1B); }
+  //! Compare each element with its partner j lanes away, keeping the larger
+  //! in the lanes set in hi and the smaller in the others
+  template <int j, int hi> static intrinsic_t exchange(const intrinsic_t& x) {
+    intrinsic_t p = partner<j>(x);
+    return _mm_blend_ps(_mm_min_ps(x, p), _mm_max_ps(x, p), hi);
+  }
+  //! exchange on the keys k, moving the elements of v with them
+  template <int j, int hi> static void exchange(intrinsic_t& k, intrinsic_t& v) {
+    intrinsic_t p = partner<j>(k), q = partner<j>(v);
+    intrinsic_t swap = _mm_blend_ps(_mm_cmplt_ps(p, k), _mm_cmpgt_ps(p, k), hi);
+    k = _mm_blendv_ps(k, p, swap);
+    v = _mm_blendv_ps(v, q, swap);
+  }
+  //! Lanes where a < b, as a blendv mask
+  static intrinsic_t less(const intrinsic_t& a, const intrinsic_t& b) { return _mm_cmplt_ps(a, b); }
+  //! Elements of b where mask is set, else of a
+  static intrinsic_t select(const intrinsic_t& a, const intrinsic_t& b, const intrinsic_t& mask) {
+    return _mm_blendv_ps(a, b, mask);
+  }
+#endif
+  //! Sort the elements into ascending order. NaNs are not supported
+  friend inline self_t sort(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    // Optimal five comparator network
+    scalar_t v[step] = { a.data.v0, a.data.v1, a.data.v2, a.data.v3 };
+    const int pairs[5][2] = { { 0, 1 }, { 2, 3 }, { 0, 2 }, { 1, 3 }, { 1, 2 } };
+    for (const auto& p : pairs) {
+      scalar_t lo = SVL_MIN(v[p[0]], v[p[1]]), hi = SVL_MAX(v[p[0]], v[p[1]]);
+      v[p[0]] = lo;
+      v[p[1]] = hi;
+    }
+    return self_t(v[0], v[1], v[2], v[3]);
+#else
+    intrinsic_t x = a;
+    x = exchange<1, 0x6>(x);
+    x = exchange<2, 0xC>(x);
+    x = exchange<1, 0xA>(x);
+    return x;
+#endif
+  }
+  //! Sort keys into ascending order, moving the elements of values (which may
+  //! hold any bit patterns, e.g. indices) with them. NaN keys are not supported
+  friend inline void sort(self_t& keys, self_t& values) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t k[step], v[step];
+    keys.store(k);
+    values.store(v);
+    for (i64 i = 1; i < step; ++i)
+      for (i64 j = i; j > 0 && k[j] < k[j - 1]; --j) {
+        std::swap(k[j], k[j - 1]);
+        std::swap(v[j], v[j - 1]);
+      }
+    keys.load(k);
+    values.load(v);
+#else
+    exchange<1, 0x6>(keys.data, values.data);
+    exchange<2, 0xC>(keys.data, values.data);
+    exchange<1, 0xA>(keys.data, values.data);
+#endif
+  }
+  //! Merge two sorted vectors, leaving the lowest step elements in a and the
+  //! highest in b, both sorted
+  friend inline void merge_sorted(self_t& a, self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t x[2 * step], r[2 * step];
+    a.store(x);
+    b.store(x + step);
+    for (i64 i = 0, ia = 0, ib = step; i < 2 * step; ++i)
+      r[i] = (ib == 2 * step || (ia < step && x[ia] <= x[ib])) ? x[ia++] : x[ib++];
+    a.load(r);
+    b.load(r + step);
+#else
+    // Reversing b makes a, b bitonic, so splitting into the lane wise minima
+    // and maxima then cleaning up each half sorts them
+    intrinsic_t r = reverse(b);
+    intrinsic_t lo = min(a, self_t(r)), hi = max(a, self_t(r));
+    lo = exchange<2, 0xC>(lo);
+    lo = exchange<1, 0xA>(lo);
+    hi = exchange<2, 0xC>(hi);
+    hi = exchange<1, 0xA>(hi);
+    a = lo;
+    b = hi;
+#endif
+  }
+  //! Merge two sorted vectors of keys, leaving the lowest step keys in ka and
+  //! the highest in kb, and moving the elements of va and vb with them
+  friend inline void merge_sorted(self_t& ka, self_t& va, self_t& kb, self_t& vb) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    scalar_t k[2 * step], v[2 * step], rk[2 * step], rv[2 * step];
+    ka.store(k);
+    kb.store(k + step);
+    va.store(v);
+    vb.store(v + step);
+    for (i64 i = 0, ia = 0, ib = step; i < 2 * step; ++i) {
+      i64 src = (ib == 2 * step || (ia < step && k[ia] <= k[ib])) ? ia++ : ib++;
+      rk[i] = k[src];
+      rv[i] = v[src];
+    }
+    ka.load(rk);
+    kb.load(rk + step);
+    va.load(rv);
+    vb.load(rv + step);
+#else
+    // As for keys alone, splitting on the comparison of the keys
+    intrinsic_t rk = reverse(kb), rv = reverse(vb);
+    auto lower = less(rk, ka);
+    intrinsic_t lk = select(ka, rk, lower), lv = select(va, rv, lower);
+    intrinsic_t hk = select(rk, ka, lower), hv = select(rv, va, lower);
+    exchange<2, 0xC>(lk, lv);
+    exchange<1, 0xA>(lk, lv);
+    exchange<2, 0xC>(hk, hv);
+    exchange<1, 0xA>(hk, hv);
+    ka = lk;
+    va = lv;
+    kb = hk;
+    vb = hv;
 #endif
   }
 };
@@ -4,6 +4,10 @@
 
 struct Vector8f {
   VECTOR_NUMBER_SETUP(Vector8f, 8, Vector8b, flt, Vector4f);
+  //! Whether fma rounds once, as it does at every level but SSE
+  static const bool fused_fma = SVL_SIMD_LEVEL != SVL_SSE;
+  //! Unsigned 64 bit integers of the same width, for working on the bits
+  using bits_t = Vector4u64;
   
 #if SVL_SIMD_LEVEL < SVL_AVX2
   using intrinsic_t = struct { half_t v0_3, v4_7; };
@@ -156,6 +160,138 @@ struct Vector8f {
     }
 #endif
   }
+
+  // Half precision and bfloat16 storage
+  //! Load step IEEE half precision values and widen them to float
+  self_t& load_f16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_f16(arr);
+    data.v4_7.load_f16(arr + half_step);
+#else
+    data = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)arr));
+#endif
+    return *this;
+  }
+  //! Store the values as IEEE half precision, rounding to nearest even
+  void store_f16(u16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.store_f16(arr);
+    data.v4_7.store_f16(arr + half_step);
+#else
+    _mm_storeu_si128((__m128i*)arr, _mm256_cvtps_ph(data, _MM_FROUND_TO_NEAREST_INT));
+#endif
+  }
+  //! Load step bfloat16 values and widen them to float
+  self_t& load_bf16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_bf16(arr);
+    data.v4_7.load_bf16(arr + half_step);
+#else
+    data = _mm256_castsi256_ps(_mm256_slli_epi32(
+        _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)arr)), 16));
+#endif
+    return *this;
+  }
+  //! Store the values as bfloat16, rounding to nearest even
+  void store_bf16(u16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.store_bf16(arr);
+    data.v4_7.store_bf16(arr + half_step);
+#else
+    __m256i bits = _mm256_castps_si256(data);
+    __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    __m256i r = _mm256_srli_epi32(
+        _mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff))), 16);
+    // Rounding could carry a NaN into infinity, so truncate those instead
+    __m256i nan = _mm256_or_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(0x40));
+    r = _mm256_blendv_epi8(r, nan, _mm256_castps_si256(_mm256_cmp_ps(data, data, _CMP_UNORD_Q)));
+    // Pack within each 128 bit lane, then gather the low halves of both lanes
+    r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+    _mm_storeu_si128((__m128i*)arr, _mm256_castsi256_si128(r));
+#endif
+  }
+
+  // Integer storage
+  //! Load step unsigned bytes and convert them to float
+  self_t& load_u8(const u8* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_u8(arr);
+    data.v4_7.load_u8(arr + half_step);
+#else
+    data = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step signed bytes and convert them to float
+  self_t& load_i8(const i8* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_i8(arr);
+    data.v4_7.load_i8(arr + half_step);
+#else
+    data = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step unsigned 16 bit integers and convert them to float
+  self_t& load_u16(const u16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_u16(arr);
+    data.v4_7.load_u16(arr + half_step);
+#else
+    data = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step signed 16 bit integers and convert them to float
+  self_t& load_i16(const i16* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_i16(arr);
+    data.v4_7.load_i16(arr + half_step);
+#else
+    data = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)arr)));
+#endif
+    return *this;
+  }
+  //! Load step 32 bit integers and convert them to float
+  self_t& load_i32(const i32* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.load_i32(arr);
+    data.v4_7.load_i32(arr + half_step);
+#else
+    data = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)arr));
+#endif
+    return *this;
+  }
+  //! Store the values rounded to nearest even and saturated to [0, 255]. NaN
+  //! becomes 0
+  void store_u8_sat(u8* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.store_u8_sat(arr);
+    data.v4_7.store_u8_sat(arr + half_step);
+#else
+    __m256i v = _mm256_cvtps_epi32(
+        _mm256_min_ps(_mm256_max_ps(data, _mm256_setzero_ps()), SVL_CONSTANT(self_t, 255.f)));
+    // Pack within each 128 bit lane, then gather the low halves of both lanes
+    __m128i s = _mm256_castsi256_si128(
+        _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v), 0x08));
+    _mm_storel_epi64((__m128i*)arr, _mm_packus_epi16(s, s));
+#endif
+  }
+  //! Store the values rounded to nearest even and saturated to
+  //! [-32768, 32767]. NaN becomes -32768
+  void store_i16_sat(i16* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_3.store_i16_sat(arr);
+    data.v4_7.store_i16_sat(arr + half_step);
+#else
+    __m256i v = _mm256_cvtps_epi32(
+        _mm256_min_ps(_mm256_max_ps(data, SVL_CONSTANT(self_t, -32768.f)),
+                      SVL_CONSTANT(self_t, 32767.f)));
+    // Pack within each 128 bit lane, then gather the low halves of both lanes
+    v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v), 0x08);
+    _mm_storeu_si128((__m128i*)arr, _mm256_castsi256_si128(v));
+#endif
+  }
   
   // Access single value
   //! RO access to a single value
@@ -307,6 +443,8 @@ struct Vector8f {
 #if SVL_SIMD_LEVEL < SVL_AVX2
     return self_t(a.data.v0_3 / b.data.v0_3,
                   a.data.v4_7 / b.data.v4_7);
+#elif defined(SVL_FAST_MATH)
+    return a * rcp_nr(b);
 #else
     return _mm256_div_ps(a, b);
 #endif
@@ -397,6 +535,30 @@ struct Vector8f {
     return _mm256_blendv_ps(b, a, _mm256_castsi256_ps(c));
 #endif
   }
+  //! Elements table[index[i]], where index holds whole numbers
+  friend inline self_t gather(const scalar_t* table, const self_t& index) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(gather(table, index.data.v0_3), gather(table, index.data.v4_7));
+#else
+    return _mm256_i32gather_ps(table, _mm256_cvttps_epi32(index), 4);
+#endif
+  }
+  //! Elements table[index[i]] of a table held in a vector, where index
+  //! holds whole numbers in [0, step)
+  friend inline self_t lookup(const self_t& table, const self_t& index) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    // Look up in both halves of the table, keeping the one the index is in
+    auto pick = [&table](const half_t& i) {
+      const half_t middle = half_t(flt(half_step));
+      return blend(lookup(table.data.v4_7, max(i - middle, half_t::zeros())),
+                   lookup(table.data.v0_3, min(i, middle - 1.f)), i >= middle);
+    };
+    return self_t(pick(index.data.v0_3), pick(index.data.v4_7));
+#else
+    return _mm256_permutevar8x32_ps(table, _mm256_cvttps_epi32(index));
+#endif
+  }
+
   //! Returns the sum of all elements
   friend inline scalar_t horizontal_add(const self_t& a) {
 #if SVL_SIMD_LEVEL < SVL_AVX2
@@ -406,6 +568,20 @@ struct Vector8f {
     tmp = _mm256_hadd_ps(tmp, tmp);
     return half_t(_mm256_extractf128_ps(tmp, 0) +
                   _mm256_extractf128_ps(tmp, 1))[0];
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i]. The sums are
+  //! formed in log2(step) steps so may round differently to a running sum
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    half_t lo = prefix_sum(a.data.v0_3);
+    return self_t(lo, prefix_sum(a.data.v4_7) + half_t(lo[half_step - 1]));
+#else
+    // Scan each 128 bit lane, then add the total of the low lane to the high one
+    __m256 x = _mm256_add_ps(a, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(a), 4)));
+    x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 8)));
+    __m256 t = _mm256_permute_ps(x, 0xff);
+    return _mm256_add_ps(x, _mm256_permute2f128_ps(t, t, 0x08));
 #endif
   }
   //! Find the maximum elements between two vectors
@@ -447,15 +623,96 @@ struct Vector8f {
 #endif
   }
   
+  //! Multiply add of a * b + c. Only fused from AVX2 upwards
+  friend inline self_t fma(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(fma(a.data.v0_3, b.data.v0_3, c.data.v0_3),
+                  fma(a.data.v4_7, b.data.v4_7, c.data.v4_7));
+#else
+    return _mm256_fmadd_ps(a, b, c);
+#endif
+  }
+  //! Negated multiply add of c - a * b. Only fused from AVX2 upwards
+  friend inline self_t fnma(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(fnma(a.data.v0_3, b.data.v0_3, c.data.v0_3),
+                  fnma(a.data.v4_7, b.data.v4_7, c.data.v4_7));
+#else
+    return _mm256_fnmadd_ps(a, b, c);
+#endif
+  }
+  
   // Special math functions
   //! Finds the square root of all elements in a
   friend inline self_t sqrt(const self_t& a) {
 #if SVL_SIMD_LEVEL < SVL_AVX2
     return self_t(sqrt(a.data.v0_3), sqrt(a.data.v4_7));
+#elif defined(SVL_FAST_MATH)
+    return blend(a, a * rsqrt_nr(a), (a == zeros()) | (a == SVL_CONSTANT(self_t, HUGE_VALF)));
 #else
     return _mm256_sqrt_ps(a);
 #endif
   }
+  //! Approximate reciprocal of all elements in x, relative error <= 1.5 * 2^-12.
+  //! Exact in the scalar namespace
+  friend inline self_t rcp(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(rcp(x.data.v0_3), rcp(x.data.v4_7));
+#else
+    return _mm256_rcp_ps(x);
+#endif
+  }
+  //! Reciprocal of all elements in x refined with one Newton-Raphson step,
+  //! relative error <= 2^-22. Gives NaN for zero or infinite x
+  friend inline self_t rcp_nr(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(rcp_nr(x.data.v0_3), rcp_nr(x.data.v4_7));
+#else
+    self_t r = rcp(x);
+    return fma(r, fnma(x, r, 1.f), r);
+#endif
+  }
+  //! Reciprocal of all elements in x refined with two Newton-Raphson steps,
+  //! relative error <= 2^-23. Gives NaN for zero or infinite x
+  friend inline self_t rcp_nr2(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(rcp_nr2(x.data.v0_3), rcp_nr2(x.data.v4_7));
+#else
+    self_t r = rcp_nr(x);
+    return fma(r, fnma(x, r, 1.f), r);
+#endif
+  }
+  //! Approximate reciprocal square root of all elements in x, relative error
+  //! <= 1.5 * 2^-12. Exact in the scalar namespace
+  friend inline self_t rsqrt(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(rsqrt(x.data.v0_3), rsqrt(x.data.v4_7));
+#else
+    return _mm256_rsqrt_ps(x);
+#endif
+  }
+  //! Reciprocal square root of all elements in x refined with one
+  //! Newton-Raphson step, relative error <= 2^-21. Gives NaN for zero or
+  //! infinite x
+  friend inline self_t rsqrt_nr(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(rsqrt_nr(x.data.v0_3), rsqrt_nr(x.data.v4_7));
+#else
+    self_t r = rsqrt(x);
+    return fma(r * 0.5f, fnma(x * r, r, 1.f), r);
+#endif
+  }
+  //! Reciprocal square root of all elements in x refined with two
+  //! Newton-Raphson steps, relative error <= 2^-22.5. Gives NaN for zero or
+  //! infinite x
+  friend inline self_t rsqrt_nr2(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(rsqrt_nr2(x.data.v0_3), rsqrt_nr2(x.data.v4_7));
+#else
+    self_t r = rsqrt_nr(x);
+    return fma(r * 0.5f, fnma(x * r, r, 1.f), r);
+#endif
+  }
   
   //! Calculates the sine of all elements in x
   friend inline self_t sin(const self_t& x) {
@@ -505,18 +762,15 @@ struct Vector8f {
     return self_t(acos(x.data.v0_3), acos(x.data.v4_7));
 #else
     // Constants
-    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
-    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
-    const __m256 halves = _mm256_set1_ps(0.5f);
+    const __m256 abs_mask = constant<self_t, 0x7FFFFFFFu>();
+    const __m256 sign_mask = constant<self_t, 0x80000000u>();
+    const __m256 halves = SVL_CONSTANT(self_t, 0.5f);
     const __m256 zeroes = _mm256_setzero_ps();
-    const __m256 pis = _mm256_set1_ps(3.14159265358979323846264338327950288419716939937510582097f);
-    const __m256 half_pis = _mm256_set1_ps(3.14159265358979323846264338327950288419716939937510582097f * 0.5f);
+    const __m256 pis = SVL_CONSTANT(self_t, 3.14159265358979323846264338327950288419716939937510582097f);
+    const __m256 half_pis = SVL_CONSTANT(self_t, 3.14159265358979323846264338327950288419716939937510582097f * 0.5f);
 
-    const __m256 C4 = _mm256_set1_ps(4.2163199048E-2f);
-    const __m256 C3 = _mm256_set1_ps(2.4181311049E-2f);
-    const __m256 C2 = _mm256_set1_ps(4.5470025998E-2f);
-    const __m256 C1 = _mm256_set1_ps(7.4953002686E-2f);
-    const __m256 C0 = _mm256_set1_ps(1.6666752422E-1f);
+    static constexpr flt acos_poly[] = { 1.6666752422E-1f, 7.4953002686E-2f, 4.5470025998E-2f,
+                                         2.4181311049E-2f, 4.2163199048E-2f };
     // End constants
     
     __m256 abs_x = _mm256_and_ps(x, abs_mask);
@@ -527,13 +781,7 @@ struct Vector8f {
     __m256 sqrt_x1 = _mm256_sqrt_ps(x1);
     __m256 x4 = _mm256_blendv_ps(abs_x, sqrt_x1, selector);
 
-    // Calculate c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0 where x = x3
-    __m256 x3_2 = _mm256_mul_ps(x3, x3);
-    __m256 x3_4 = _mm256_mul_ps(x3_2, x3_2);
-    __m256 c1_x_x3_p_c0 = _mm256_fmadd_ps(C1, x3, C0);
-    __m256 c3_x_x3_p_c2 = _mm256_fmadd_ps(C3, x3, C2);
-    __m256 c4_x_x34_p_y = _mm256_fmadd_ps(C4, x3_4, c1_x_x3_p_c0);
-    __m256 res = _mm256_fmadd_ps(c3_x_x3_p_c2, x3_2, c4_x_x34_p_y);
+    __m256 res = estrin<acos_poly>(self_t(x3));
     res = _mm256_fmadd_ps(res, _mm256_mul_ps(x3, x4), x4);
     __m256 res1 = _mm256_add_ps(res, res);
 
@@ -559,32 +807,35 @@ struct Vector8f {
 #endif
   }
   //! Calculates the arctangent of all elements in y/x determining the correct quadrant
-  friend inline self_t atan2(const self_t& y, const self_t& x) {
+  friend SVL_INLINE self_t atan2(const self_t& y, const self_t& x) {
 #if SVL_SIMD_LEVEL < SVL_AVX2
     return self_t(atan2(y.data.v0_3, x.data.v0_3),
                   atan2(y.data.v4_7, x.data.v4_7));
 #else
     // Constants
-    const __m256 C3 = _mm256_set1_ps(8.05374449538E-2f);
-    const __m256 C2 = _mm256_set1_ps(-1.38776856032E-1f);
-    const __m256 C1 = _mm256_set1_ps(1.99777106478E-1f);
-    const __m256 C0 = _mm256_set1_ps(-3.33329491539E-1f);
-    const __m256 piover2 = _mm256_set1_ps(1.57079632679489661923f);
-    const __m256 pi = _mm256_set1_ps(3.14159265358979323846f);
-    const __m256 sqrt2_minus1 = _mm256_set1_ps(0.41421356237309504880f);
-    const __m256 minus1 = _mm256_set1_ps(-1.f);
-    const __m256 plus1 = _mm256_set1_ps(1.f);
-    const __m256 piover4 = _mm256_set1_ps(0.785398163397448309616f);
-    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    static constexpr flt atan_poly[] = { -3.33329491539E-1f, 1.99777106478E-1f,
+                                         -1.38776856032E-1f, 8.05374449538E-2f };
+    const __m256 piover2 = SVL_CONSTANT(self_t, 1.57079632679489661923f);
+    const __m256 pi = SVL_CONSTANT(self_t, 3.14159265358979323846f);
+    const __m256 sqrt2_minus1 = SVL_CONSTANT(self_t, 0.41421356237309504880f);
+    const __m256 minus1 = SVL_CONSTANT(self_t, -1.f);
+    const __m256 plus1 = SVL_CONSTANT(self_t, 1.f);
+    const __m256 piover4 = SVL_CONSTANT(self_t, 0.785398163397448309616f);
+    const __m256 sign_mask = constant<self_t, 0x80000000u>();
     // End constants
     
     __m256 x1 = abs(x), y1 = abs(y);
-    __m256 swapxy = _mm256_castps_si256(_mm256_cmp_ps(y1, x1, 14));
+    // Both infinite gives a multiple of pi/4 rather than inf/inf
+    const __m256 inf = SVL_CONSTANT(self_t, HUGE_VALF);
+    __m256 both_inf = _mm256_and_ps(_mm256_cmp_ps(x1, inf, 0), _mm256_cmp_ps(y1, inf, 0));
+    x1 = _mm256_blendv_ps(x1, plus1, both_inf);
+    y1 = _mm256_blendv_ps(y1, plus1, both_inf);
+    __m256 swapxy = _mm256_cmp_ps(y1, x1, 14);
     __m256 x2 = _mm256_blendv_ps(x1, y1, swapxy);
     __m256 y2 = _mm256_blendv_ps(y1, x1, swapxy);
     __m256 t = _mm256_div_ps(y2, x2);
     
-    __m256 notsmall = _mm256_castps_si256(_mm256_cmp_ps(t, sqrt2_minus1, 13));
+    __m256 notsmall = _mm256_cmp_ps(t, sqrt2_minus1, 13);
     __m256 a = _mm256_add_ps(t, _mm256_and_ps(notsmall, minus1));
     __m256 b = _mm256_add_ps(plus1, _mm256_and_ps(notsmall, t));
     __m256 s = _mm256_and_ps(notsmall, piover4);
@@ -592,17 +843,13 @@ struct Vector8f {
     
     __m256 zsq = _mm256_mul_ps(z, z);
     
-    // Polynomial 3
-    __m256 zsqsq = _mm256_mul_ps(zsq, zsq);
-    __m256 fma1 = _mm256_fmadd_ps(C3, zsq, C2);
-    __m256 fma2 = _mm256_fmadd_ps(C1, zsq, C0);
-    __m256 res = _mm256_fmadd_ps(fma1, zsqsq, fma2);
+    __m256 res = estrin<atan_poly>(self_t(zsq));
     res = _mm256_fmadd_ps(res, _mm256_mul_ps(zsq, z), z);
     res = _mm256_add_ps(res, s);
     
     res = _mm256_blendv_ps(res, _mm256_sub_ps(piover2, res), swapxy);
-    res = _mm256_blendv_ps(res, _mm256_sub_ps(pi, res), _mm256_castps_si256(_mm256_cmp_ps(x, _mm256_setzero_ps(), 1)));
-    res = _mm256_blendv_ps(res, _mm256_setzero_ps(), _mm256_castps_si256(_mm256_cmp_ps(_mm256_or_ps(x, y), _mm256_setzero_ps(), 0)));
+    res = _mm256_blendv_ps(res, _mm256_sub_ps(pi, res), _mm256_cmp_ps(x, _mm256_setzero_ps(), 1));
+    res = _mm256_blendv_ps(res, _mm256_setzero_ps(), _mm256_cmp_ps(_mm256_or_ps(x, y), _mm256_setzero_ps(), 0));
     
     res = _mm256_xor_ps(res, _mm256_and_ps(y, sign_mask));
     return res;
@@ -613,11 +860,22 @@ struct Vector8f {
 #if SVL_SIMD_LEVEL < SVL_AVX2
     return self_t(abs(x.data.v0_3), abs(x.data.v4_7));
 #else
-    __m256i mask = _mm256_set_epi32(0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
-                                    0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF);
-    return _mm256_and_ps(_mm256_castsi256_ps(mask), x.data);
+    return _mm256_and_ps(constant<self_t, 0x7FFFFFFFu>(), x.data);
+#endif
+  }
+  //! Magnitudes of x with the signs of y
+  friend inline self_t copysign(const self_t& x, const self_t& y) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(copysign(x.data.v0_3, y.data.v0_3), copysign(x.data.v4_7, y.data.v4_7));
+#else
+    const intrinsic_t s = constant<self_t, 0x80000000u>();
+    return _mm256_or_ps(_mm256_andnot_ps(s, x), _mm256_and_ps(s, y));
 #endif
   }
+  //! 1 with the sign of x for non zero x. Zeros and NaNs are returned as is
+  friend inline self_t sign(const self_t& x) {
+    return blend(x, copysign(SVL_CONSTANT(self_t, 1.f), x), (x == zeros()) | isnan(x));
+  }
   
   //! Floor of the values of x
   friend inline self_t floor(const self_t& x) {
@@ -636,7 +894,7 @@ struct Vector8f {
 #endif
   }
   
-  //! Round the values of x
+  //! Round the values of x to the nearest integer, ties to even
   friend inline self_t round(const self_t& x) {
 #if SVL_SIMD_LEVEL < SVL_AVX2
     return self_t(round(x.data.v0_3), round(x.data.v4_7));
@@ -644,7 +902,383 @@ struct Vector8f {
     return _mm256_round_ps(x.data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
 #endif
   }
+  //! Round the values of x towards zero
+  friend inline self_t trunc(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(trunc(x.data.v0_3), trunc(x.data.v4_7));
+#else
+    return _mm256_round_ps(x.data, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#endif
+  }
+  //! Fractional part x - floor(x) of the values of x, in [0, 1). NaN for
+  //! infinite or NaN x
+  friend inline self_t fract(const self_t& x) {
+    return min(constant<self_t, 0x3F7FFFFFu>(), x - floor(x));
+  }
+  //! Remainder of x / y with the sign of x, exactly as std::fmod. NaN for
+  //! zero y or infinite x
+  friend inline self_t fmod(const self_t& x, const self_t& y) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(fmod(x.data.v0_3, y.data.v0_3), fmod(x.data.v4_7, y.data.v4_7));
+#else
+    // Take off whole multiples of y * 2^k, 20 bits of quotient at a time.
+    // Each step is exact as the fused remainder fits in a float
+    const self_t tiny = constant<self_t, 0x00800000u>(), up = SVL_CONSTANT(self_t, 16777216.f);
+    const self_t b = abs(y);
+    const self_t eb = blend(exponent(b * up) - 24.f, exponent(b), b < tiny);
+    self_t r = abs(x);
+    bool_t active = (r >= b) & (b > zeros()) & isfinite(r);
+    while (active.any()) {
+      const self_t er = blend(exponent(r * up) - 24.f, exponent(r), r < tiny);
+      const self_t bs = ldexp(b, max(er - eb - 20.f, zeros()));
+      self_t rem = fnma(trunc(r / bs), bs, r);
+      rem = blend(rem + bs, rem, rem < zeros());
+      r = blend(rem, r, active);
+      active &= r >= b;
+    }
+    const bool_t invalid = (y == zeros()) | isinf(x) | isnan(y);
+    return blend(constant<self_t, 0x7FC00000u>(), copysign(r, x), invalid);
+#endif
+  }
+  //! IEEE remainder x - n * y, with n the nearest integer to x / y, ties to
+  //! even, exactly as std::remainder
+  friend inline self_t remainder(const self_t& x, const self_t& y) {
+    // Reduce into [0, 2|y|) then take off |y| up to twice. Each subtraction
+    // is exact as the operands are within a factor of two
+    const self_t p = abs(y);
+    self_t r = abs(fmod(x, p + p));
+    bool_t over = r + r > p;
+    r = blend(r - p, r, over);
+    r = blend(r - p, r, over & (r + r >= p));
+    return r * copysign(SVL_CONSTANT(self_t, 1.f), x);
+  }
   
+  // Exponent manipulation
+  //! Returns 2^n for all integer valued elements of n in [-126, 127]
+  friend inline self_t pow2n(const self_t& n) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(pow2n(n.data.v0_3), pow2n(n.data.v4_7));
+#else
+    __m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_castps_si256(constant<self_t, 127u>()));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+#endif
+  }
+  //! Returns the exponent, floor(log2(|x|)), of all normal elements in x
+  friend inline self_t exponent(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(exponent(x.data.v0_3), exponent(x.data.v4_7));
+#else
+    __m256i e = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+    e = _mm256_and_si256(e, _mm256_castps_si256(constant<self_t, 0xFFu>()));
+    return _mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_castps_si256(constant<self_t, 127u>())));
+#endif
+  }
+  //! Returns the mantissa, in [1, 2), of all normal elements in x
+  friend inline self_t fraction(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(fraction(x.data.v0_3), fraction(x.data.v4_7));
+#else
+    __m256i m = _mm256_and_si256(_mm256_castps_si256(x), _mm256_castps_si256(constant<self_t, 0x007FFFFFu>()));
+    return _mm256_castsi256_ps(_mm256_or_si256(m, _mm256_castps_si256(constant<self_t, 0x3F800000u>())));
+#endif
+  }
+  //! Splits x into a mantissa, returned, with magnitude in [0.5, 1) and the
+  //! sign of x, and whole number exponents e with x = mantissa * 2^e. Zeros,
+  //! infinities and NaNs are returned as is with e = 0
+  friend inline self_t frexp(const self_t& x, self_t& e) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    half_t e0_3, e4_7;
+    self_t m(frexp(x.data.v0_3, e0_3), frexp(x.data.v4_7, e4_7));
+    e = self_t(e0_3, e4_7);
+    return m;
+#else
+    // Denormals are scaled up by 2^24 to make them normal
+    const bool_t small = abs(x) < constant<self_t, 0x00800000u>();
+    const intrinsic_t s = blend(x * SVL_CONSTANT(self_t, 16777216.f), x, small);
+    __m256i bits = _mm256_castps_si256(s);
+    __m256i ex = _mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_castps_si256(constant<self_t, 0xFFu>()));
+    const bool_t special = (x == zeros()) | ~isfinite(x);
+    const self_t unbiased = _mm256_cvtepi32_ps(_mm256_sub_epi32(ex, _mm256_castps_si256(constant<self_t, 126u>())));
+    e = blend(zeros(), unbiased - blend(SVL_CONSTANT(self_t, 24.f), zeros(), small), special);
+    bits = _mm256_and_si256(bits, _mm256_castps_si256(constant<self_t, 0x807FFFFFu>()));
+    return blend(x, _mm256_castsi256_ps(_mm256_or_si256(bits, _mm256_castps_si256(constant<self_t, 0x3F000000u>()))), special);
+#endif
+  }
+  //! x * 2^n for whole numbers n, without overflowing or underflowing before
+  //! the final result
+  friend inline self_t ldexp(const self_t& x, const self_t& n) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(ldexp(x.data.v0_3, n.data.v0_3), ldexp(x.data.v4_7, n.data.v4_7));
+#else
+    // Scale by at most 2^127 or 2^-102 twice, then by the rest clamped to the
+    // range of pow2n, as musl's scalbnf does
+    const self_t hi = SVL_CONSTANT(self_t, 127.f), lo = SVL_CONSTANT(self_t, -126.f);
+    const self_t down = SVL_CONSTANT(self_t, -102.f);
+    self_t r = x, k = n;
+    for (int j = 0; j < 2; ++j) {
+      const self_t s = blend(hi, blend(down, zeros(), k < lo), k > hi);
+      r *= pow2n(s);
+      k -= s;
+    }
+    return r * pow2n(min(max(k, lo), hi));
+#endif
+  }
+
+  // Classification
+  //! Returns true for all elements of x that are NaN
+  friend inline bool_t isnan(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return bool_t(isnan(x.data.v0_3), isnan(x.data.v4_7));
+#else
+    return _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+#endif
+  }
+  //! Returns true for all elements of x that are positive or negative infinity
+  friend inline bool_t isinf(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return bool_t(isinf(x.data.v0_3), isinf(x.data.v4_7));
+#else
+    const intrinsic_t inf = constant<self_t, 0x7F800000u>();
+    return _mm256_castps_si256(_mm256_cmp_ps(abs(x), inf, _CMP_EQ_OQ));
+#endif
+  }
+  //! Returns true for all elements of x that are neither infinite nor NaN
+  friend inline bool_t isfinite(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return bool_t(isfinite(x.data.v0_3), isfinite(x.data.v4_7));
+#else
+    const intrinsic_t inf = constant<self_t, 0x7F800000u>();
+    return _mm256_castps_si256(_mm256_cmp_ps(abs(x), inf, _CMP_LT_OQ));
+#endif
+  }
+  //! Returns true for all elements of x that are normal, so not zero,
+  //! denormal, infinite or NaN
+  friend inline bool_t isnormal(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return bool_t(isnormal(x.data.v0_3), isnormal(x.data.v4_7));
+#else
+    const intrinsic_t a = abs(x);
+    const intrinsic_t smallest = constant<self_t, 0x00800000u>(), inf = constant<self_t, 0x7F800000u>();
+    return _mm256_castps_si256(_mm256_and_ps(_mm256_cmp_ps(a, smallest, _CMP_GE_OQ),
+                                             _mm256_cmp_ps(a, inf, _CMP_LT_OQ)));
+#endif
+  }
+
+  // Complex pairs, elements 2k and 2k + 1 holding the real and imaginary
+  // parts of a complex number
+  //! Even elements copied over the odd ones after them, x0 x0 x2 x2 ...
+  friend inline self_t dup_even(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(dup_even(x.data.v0_3), dup_even(x.data.v4_7));
+#else
+    return _mm256_moveldup_ps(x);
+#endif
+  }
+  //! Odd elements copied over the even ones before them, x1 x1 x3 x3 ...
+  friend inline self_t dup_odd(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(dup_odd(x.data.v0_3), dup_odd(x.data.v4_7));
+#else
+    return _mm256_movehdup_ps(x);
+#endif
+  }
+  //! Neighbouring elements swapped, x1 x0 x3 x2 ...
+  friend inline self_t swap_pairs(const self_t& x) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(swap_pairs(x.data.v0_3), swap_pairs(x.data.v4_7));
+#else
+    return _mm256_permute_ps(x, 0xB1);
+#endif
+  }
+  //! a * b - c in the even elements and a * b + c in the odd ones. Only
+  //! fused from AVX2 upwards
+  friend inline self_t fmaddsub(const self_t& a, const self_t& b, const self_t& c) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(fmaddsub(a.data.v0_3, b.data.v0_3, c.data.v0_3),
+                  fmaddsub(a.data.v4_7, b.data.v4_7, c.data.v4_7));
+#else
+    return _mm256_fmaddsub_ps(a, b, c);
+#endif
+  }
+  //! Interleave the elements of a and b, lo = a0 b0 ... a3 b3 and
+  //! hi = a4 b4 ... a7 b7
+  friend inline void interleave(const self_t& a, const self_t& b, self_t& lo, self_t& hi) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    half_t l0, l1, h0, h1;
+    interleave(a.data.v0_3, b.data.v0_3, l0, l1);
+    interleave(a.data.v4_7, b.data.v4_7, h0, h1);
+    lo = self_t(l0, l1);
+    hi = self_t(h0, h1);
+#else
+    // Within each 128 bit lane, then the lanes put in order
+    __m256 l = _mm256_unpacklo_ps(a, b), h = _mm256_unpackhi_ps(a, b);
+    lo = _mm256_permute2f128_ps(l, h, 0x20);
+    hi = _mm256_permute2f128_ps(l, h, 0x31);
+#endif
+  }
+  //! Split the elements of lo then hi into the even ones, lo0 lo2 ... hi6,
+  //! and the odd ones, lo1 lo3 ... hi7. The inverse of interleave
+  friend inline void deinterleave(const self_t& lo, const self_t& hi, self_t& even, self_t& odd) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    half_t e0, e1, o0, o1;
+    deinterleave(lo.data.v0_3, lo.data.v4_7, e0, o0);
+    deinterleave(hi.data.v0_3, hi.data.v4_7, e1, o1);
+    even = self_t(e0, e1);
+    odd = self_t(o0, o1);
+#else
+    // Within each 128 bit lane, then the 64 bit quarters put in order
+    __m256 e = _mm256_shuffle_ps(lo, hi, 0x88), o = _mm256_shuffle_ps(lo, hi, 0xDD);
+    even = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(e), 0xD8));
+    odd = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(o), 0xD8));
+#endif
+  }
+
+  // Sliding windows
+  //! Elements S to 7 of a followed by the first S of b, the window S
+  //! elements along a then b, for S in [0, 8]
+  template <int S> static self_t align(const self_t& a, const self_t& b) {
+    static_assert(S >= 0 && S <= int(step), "The window must lie within a and b");
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    if constexpr (S < int(half_step))
+      return self_t(half_t::template align<S>(a.data.v0_3, a.data.v4_7),
+                    half_t::template align<S>(a.data.v4_7, b.data.v0_3));
+    else
+      return self_t(half_t::template align<S - int(half_step)>(a.data.v4_7, b.data.v0_3),
+                    half_t::template align<S - int(half_step)>(b.data.v0_3, b.data.v4_7));
+#else
+    if constexpr (S == 0) return a;
+    else if constexpr (S == int(step)) return b;
+    else {
+      // The middle, a4 ... a7 b0 ... b3, then alignr within each 128 bit lane
+      const __m256i mid = _mm256_castps_si256(_mm256_permute2f128_ps(a, b, 0x21));
+      if constexpr (S < int(half_step))
+        return _mm256_castsi256_ps(_mm256_alignr_epi8(mid, _mm256_castps_si256(a), 4 * S));
+      else
+        return _mm256_castsi256_ps(
+            _mm256_alignr_epi8(_mm256_castps_si256(b), mid, 4 * (S - int(half_step))));
+    }
+#endif
+  }
+
+  // Sorting networks
+#if SVL_SIMD_LEVEL >= SVL_AVX2
+  //! Elements of x swapped with those j lanes away
+  template <int j> static intrinsic_t partner(const intrinsic_t& x) {
+    if constexpr (j == 4) return _mm256_permute2f128_ps(x, x, 0x01);
+    else return _mm256_permute_ps(x, j == 1 ? 0xB1 : 0x4E);
+  }
+  //! Elements of x in reverse order
+  static intrinsic_t reverse(const intrinsic_t& x) {
+    return partner<4>(_mm256_permute_ps(x, 0x1B));
+  }
+  //! Compare each element with its partner j lanes away, keeping the larger
+  //! in the lanes set in hi and the smaller in the others
+  template <int j, int hi> static intrinsic_t exchange(const intrinsic_t& x) {
+    intrinsic_t p = partner<j>(x);
+    return _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), hi);
+  }
+  //! exchange on the keys k, moving the elements of v with them
+  template <int j, int hi> static void exchange(intrinsic_t& k, intrinsic_t& v) {
+    intrinsic_t p = partner<j>(k), q = partner<j>(v);
+    intrinsic_t swap = _mm256_blend_ps(_mm256_cmp_ps(p, k, _CMP_LT_OQ),
+                                       _mm256_cmp_ps(p, k, _CMP_GT_OQ), hi);
+    k = _mm256_blendv_ps(k, p, swap);
+    v = _mm256_blendv_ps(v, q, swap);
+  }
+  //! Lanes where a < b, as a blendv mask
+  static intrinsic_t less(const intrinsic_t& a, const intrinsic_t& b) {
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+  }
+  //! Elements of b where mask is set, else of a
+  static intrinsic_t select(const intrinsic_t& a, const intrinsic_t& b, const intrinsic_t& mask) {
+    return _mm256_blendv_ps(a, b, mask);
+  }
+#endif
+  //! Sort the elements into ascending order. NaNs are not supported
+  friend inline self_t sort(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    half_t lo = sort(a.data.v0_3), hi = sort(a.data.v4_7);
+    merge_sorted(lo, hi);
+    return self_t(lo, hi);
+#else
+    intrinsic_t x = a;
+    x = exchange<1, 0x66>(x);
+    x = exchange<2, 0x3C>(x);
+    x = exchange<1, 0x5A>(x);
+    x = exchange<4, 0xF0>(x);
+    x = exchange<2, 0xCC>(x);
+    x = exchange<1, 0xAA>(x);
+    return x;
+#endif
+  }
+  //! Sort keys into ascending order, moving the elements of values (which may
+  //! hold any bit patterns, e.g. indices) with them. NaN keys are not supported
+  friend inline void sort(self_t& keys, self_t& values) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    sort(keys.data.v0_3, values.data.v0_3);
+    sort(keys.data.v4_7, values.data.v4_7);
+    merge_sorted(keys.data.v0_3, values.data.v0_3, keys.data.v4_7, values.data.v4_7);
+#else
+    exchange<1, 0x66>(keys.data, values.data);
+    exchange<2, 0x3C>(keys.data, values.data);
+    exchange<1, 0x5A>(keys.data, values.data);
+    exchange<4, 0xF0>(keys.data, values.data);
+    exchange<2, 0xCC>(keys.data, values.data);
+    exchange<1, 0xAA>(keys.data, values.data);
+#endif
+  }
+  //! Merge two sorted vectors, leaving the lowest step elements in a and the
+  //! highest in b, both sorted
+  friend inline void merge_sorted(self_t& a, self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    // Odd-even merge of the sorted halves
+    merge_sorted(a.data.v0_3, b.data.v0_3);
+    merge_sorted(a.data.v4_7, b.data.v4_7);
+    merge_sorted(b.data.v0_3, a.data.v4_7);
+    std::swap(a.data.v4_7, b.data.v0_3);
+#else
+    // Reversing b makes a, b bitonic, so splitting into the lane wise minima
+    // and maxima then cleaning up each half sorts them
+    intrinsic_t r = reverse(b);
+    intrinsic_t lo = min(a, self_t(r)), hi = max(a, self_t(r));
+    lo = exchange<4, 0xF0>(lo);
+    lo = exchange<2, 0xCC>(lo);
+    lo = exchange<1, 0xAA>(lo);
+    hi = exchange<4, 0xF0>(hi);
+    hi = exchange<2, 0xCC>(hi);
+    hi = exchange<1, 0xAA>(hi);
+    a = lo;
+    b = hi;
+#endif
+  }
+  //! Merge two sorted vectors of keys, leaving the lowest step keys in ka and
+  //! the highest in kb, and moving the elements of va and vb with them
+  friend inline void merge_sorted(self_t& ka, self_t& va, self_t& kb, self_t& vb) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    // Odd-even merge of the sorted halves
+    merge_sorted(ka.data.v0_3, va.data.v0_3, kb.data.v0_3, vb.data.v0_3);
+    merge_sorted(ka.data.v4_7, va.data.v4_7, kb.data.v4_7, vb.data.v4_7);
+    merge_sorted(kb.data.v0_3, vb.data.v0_3, ka.data.v4_7, va.data.v4_7);
+    std::swap(ka.data.v4_7, kb.data.v0_3);
+    std::swap(va.data.v4_7, vb.data.v0_3);
+#else
+    // As for keys alone, splitting on the comparison of the keys
+    intrinsic_t rk = reverse(kb), rv = reverse(vb);
+    auto lower = less(rk, ka);
+    intrinsic_t lk = select(ka, rk, lower), lv = select(va, rv, lower);
+    intrinsic_t hk = select(rk, ka, lower), hv = select(rv, va, lower);
+    exchange<4, 0xF0>(lk, lv);
+    exchange<2, 0xCC>(lk, lv);
+    exchange<1, 0xAA>(lk, lv);
+    exchange<4, 0xF0>(hk, hv);
+    exchange<2, 0xCC>(hk, hv);
+    exchange<1, 0xAA>(hk, hv);
+    ka = lk;
+    va = lv;
+    kb = hk;
+    vb = hv;
+#endif
+  }
 };
 
 
@@ -0,0 +1,220 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <thread>
+#include <vector>
+
+// Single precision matrix multiply. Panels of A and B are packed into
+// contiguous slivers, and a micro-kernel keeps a 6 x (2 * V::step) block of
+// C in registers (12 accumulators plus 2 of B and a broadcast of A fit in
+// the 16 AVX2 registers). Matrices are row major with the given row strides.
+
+// Cache blocking for gemm, rounded to whole micro-kernel blocks: rows of A
+// packed at a time (kept in L2), depth of the packed panels (a sliver of B
+// stays in L1), and columns of B packed at a time (kept in L3)
+#ifndef SVL_GEMM_MC
+#define SVL_GEMM_MC 144
+#endif
+#ifndef SVL_GEMM_KC
+#define SVL_GEMM_KC 256
+#endif
+#ifndef SVL_GEMM_NC
+#define SVL_GEMM_NC 3072
+#endif
+
+namespace SVL {
+  namespace detail {
+    template <typename V>
+    struct gemm_kernel {
+      //! Rows and columns of C in each micro-kernel block
+      static const i64 mr = 6, nr = 2 * V::step;
+      static const i64 mc = SVL_MAX(SVL_GEMM_MC / mr, 1) * mr;
+      static const i64 kc = SVL_GEMM_KC;
+      static const i64 nc = SVL_MAX(SVL_GEMM_NC / nr, 1) * nr;
+
+      //! Pack the m x k block of a into slivers of mr rows, each k major and
+      //! zero padded to mr rows
+      static void pack_a(flt* out, const flt* a, i64 lda, i64 m, i64 k) {
+        for (i64 i = 0; i < m; i += mr) {
+          const i64 rows = SVL_MIN(mr, m - i);
+          for (i64 p = 0; p < k; ++p, out += mr) {
+            for (i64 r = 0; r < rows; ++r) out[r] = a[(i + r) * lda + p];
+            for (i64 r = rows; r < mr; ++r) out[r] = 0.f;
+          }
+        }
+      }
+      //! Pack the k x n block of b into slivers of nr columns, each k major
+      //! and zero padded to nr columns
+      static void pack_b(flt* out, const flt* b, i64 ldb, i64 k, i64 n) {
+        for (i64 j = 0; j < n; j += nr) {
+          const i64 cols = SVL_MIN(nr, n - j);
+          for (i64 p = 0; p < k; ++p, out += nr) {
+            const flt* row = b + p * ldb + j;
+            if (cols == nr) {
+              V(row).store(out);
+              V(row + V::step).store(out + V::step);
+            } else {
+              for (i64 l = 0; l < cols; ++l) out[l] = row[l];
+              for (i64 l = cols; l < nr; ++l) out[l] = 0.f;
+            }
+          }
+        }
+      }
+
+      //! c = alpha * a * b + beta * c for packed slivers a and b of depth k,
+      //! writing the first rows x cols of the block. c isn't read if beta is 0
+      static void kernel(i64 k, const flt* a, const flt* b, flt alpha, flt beta, flt* c,
+                         i64 ldc, i64 rows, i64 cols) {
+        // Named accumulators, as compilers won't reliably keep an array of
+        // them in registers
+        V c00 = V::zeros(), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+        V c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+        for (i64 p = 0; p < k; ++p, a += mr, b += nr) {
+          const V b0(b), b1(b + V::step);
+          V ar(a[0]);
+          c00 = fma(ar, b0, c00);
+          c01 = fma(ar, b1, c01);
+          ar = V(a[1]);
+          c10 = fma(ar, b0, c10);
+          c11 = fma(ar, b1, c11);
+          ar = V(a[2]);
+          c20 = fma(ar, b0, c20);
+          c21 = fma(ar, b1, c21);
+          ar = V(a[3]);
+          c30 = fma(ar, b0, c30);
+          c31 = fma(ar, b1, c31);
+          ar = V(a[4]);
+          c40 = fma(ar, b0, c40);
+          c41 = fma(ar, b1, c41);
+          ar = V(a[5]);
+          c50 = fma(ar, b0, c50);
+          c51 = fma(ar, b1, c51);
+        }
+        const V* acc[mr][2] = { { &c00, &c01 }, { &c10, &c11 }, { &c20, &c21 },
+                                { &c30, &c31 }, { &c40, &c41 }, { &c50, &c51 } };
+        if (rows == mr && cols == nr) {
+          for (i64 r = 0; r < mr; ++r)
+            for (i64 h = 0; h < 2; ++h) {
+              flt* out = c + r * ldc + h * V::step;
+              V result = *acc[r][h] * V(alpha);
+              if (beta != 0.f) result = fma(V(beta), V(out), result);
+              result.store(out);
+            }
+          return;
+        }
+        // Partial block at the edge of C
+        flt block[mr * nr];
+        for (i64 r = 0; r < mr; ++r) {
+          acc[r][0]->store(block + r * nr);
+          acc[r][1]->store(block + r * nr + V::step);
+        }
+        for (i64 r = 0; r < rows; ++r)
+          for (i64 l = 0; l < cols; ++l) {
+            flt& out = c[r * ldc + l];
+            out = alpha * block[r * nr + l] + (beta != 0.f ? beta * out : 0.f);
+          }
+      }
+    };
+
+    //! c = alpha * a * b + beta * c on a single thread
+    template <typename V>
+    inline void gemm(i64 m, i64 n, i64 k, flt alpha, const flt* a, i64 lda, const flt* b,
+                     i64 ldb, flt beta, flt* c, i64 ldc) {
+      using K = gemm_kernel<V>;
+      if (k == 0 || alpha == 0.f) {
+        for (i64 i = 0; i < m; ++i)
+          for (i64 j = 0; j < n; ++j) c[i * ldc + j] = beta != 0.f ? beta * c[i * ldc + j] : 0.f;
+        return;
+      }
+      std::vector<flt> packed_a(K::mc * SVL_MIN(k, K::kc));
+      std::vector<flt> packed_b(SVL_MIN(k, K::kc) * SVL_MIN((n + K::nr - 1) / K::nr * K::nr, K::nc));
+      for (i64 jc = 0; jc < n; jc += K::nc) {
+        const i64 nc = SVL_MIN(K::nc, n - jc);
+        for (i64 pc = 0; pc < k; pc += K::kc) {
+          const i64 kc = SVL_MIN(K::kc, k - pc);
+          K::pack_b(packed_b.data(), b + pc * ldb + jc, ldb, kc, nc);
+          // Later panels add to what the first left in c
+          const flt beta_p = pc == 0 ? beta : 1.f;
+          for (i64 ic = 0; ic < m; ic += K::mc) {
+            const i64 mc = SVL_MIN(K::mc, m - ic);
+            K::pack_a(packed_a.data(), a + ic * lda + pc, lda, mc, kc);
+            for (i64 jr = 0; jr < nc; jr += K::nr)
+              for (i64 ir = 0; ir < mc; ir += K::mr)
+                K::kernel(kc, packed_a.data() + ir * kc, packed_b.data() + jr * kc, alpha, beta_p,
+                          c + (ic + ir) * ldc + jc + jr, ldc, SVL_MIN(K::mr, mc - ir),
+                          SVL_MIN(K::nr, nc - jr));
+          }
+        }
+      }
+    }
+
+    //! gemm with the rows or columns of c, whichever there are more blocks
+    //! of, split between up to threads threads
+    template <typename V>
+    inline void parallel_gemm(i64 m, i64 n, i64 k, flt alpha, const flt* a, i64 lda,
+                              const flt* b, i64 ldb, flt beta, flt* c, i64 ldc, i64 threads) {
+      using K = gemm_kernel<V>;
+      const i64 row_blocks = (m + K::mr - 1) / K::mr, col_blocks = (n + K::nr - 1) / K::nr;
+      const bool by_rows = row_blocks >= col_blocks;
+      const i64 blocks = by_rows ? row_blocks : col_blocks;
+      // Don't bother with threads for less than about a million multiply adds each
+      threads = SVL_CLAMP(1, threads, SVL_MIN(blocks, SVL_MAX(1, m * n * k >> 20)));
+      if (threads == 1) return gemm<V>(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+      const i64 per_thread = (blocks + threads - 1) / threads;
+      std::vector<std::thread> workers;
+      for (i64 t = 0; t < threads; ++t)
+        workers.emplace_back([&, t]() {
+          if (by_rows) {
+            i64 begin = SVL_MIN(t * per_thread * K::mr, m);
+            i64 end = SVL_MIN(begin + per_thread * K::mr, m);
+            gemm<V>(end - begin, n, k, alpha, a + begin * lda, lda, b, ldb, beta,
+                    c + begin * ldc, ldc);
+          } else {
+            i64 begin = SVL_MIN(t * per_thread * K::nr, n);
+            i64 end = SVL_MIN(begin + per_thread * K::nr, n);
+            gemm<V>(m, end - begin, k, alpha, a, lda, b + begin, ldb, beta, c + begin, ldc);
+          }
+        });
+      for (std::thread& w : workers) w.join();
+    }
+  }
+
+  //! c = alpha * a * b + beta * c, where a is m x k, b is k x n and c is
+  //! m x n, all row major with row strides lda, ldb and ldc. c isn't read
+  //! if beta is 0
+  template <typename V = Vec8f>
+  inline void gemm(i64 m, i64 n, i64 k, flt alpha, const flt* a, i64 lda, const flt* b,
+                   i64 ldb, flt beta, flt* c, i64 ldc) {
+    detail::gemm<V>(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+  }
+  //! gemm split over up to threads threads
+  template <typename V = Vec8f>
+  inline void parallel_gemm(i64 m, i64 n, i64 k, flt alpha, const flt* a, i64 lda,
+                            const flt* b, i64 ldb, flt beta, flt* c, i64 ldc,
+                            i64 threads = std::thread::hardware_concurrency()) {
+    detail::parallel_gemm<V>(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, threads);
+  }
+
+  //! c = a * b for small fixed size dense row major matrices, a M x K, b
+  //! K x N and c M x N. The loops are unrolled at compile time, so this
+  //! beats gemm when the matrices fit in a few registers
+  template <i64 M, i64 N, i64 K, typename V = Vec8f>
+  inline void matmul(flt* c, const flt* a, const flt* b) {
+    constexpr i64 blocks = (N + V::step - 1) / V::step;
+    detail::unrolled(std::make_integer_sequence<i64, M>(), [&](auto i) {
+      detail::unrolled(std::make_integer_sequence<i64, blocks>(), [&](auto jb) {
+        constexpr i64 j = decltype(jb)::value * V::step;
+        constexpr i64 cols = SVL_MIN(i64(V::step), N - j);
+        V acc = V::zeros();
+        detail::unrolled(std::make_integer_sequence<i64, K>(), [&](auto p) {
+          const flt* row = b + p * N + j;
+          if constexpr (cols == V::step) acc = fma(V(a[i * K + p]), V(row), acc);
+          else acc = fma(V(a[i * K + p]), V().load_partial(row, cols), acc);
+        });
+        if constexpr (cols == V::step) acc.store(c + i * N + j);
+        else acc.store_partial(c + i * N + j, cols);
+      });
+    });
+  }
+}
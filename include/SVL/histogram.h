@@ -0,0 +1,158 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <thread>
+#include <vector>
+
+// Histograms of arrays of floats. The bin of each element is worked out in
+// V registers, then counted into several interleaved sub-histograms so that
+// runs of equal bins don't wait on each other's increments. Bins are half
+// open [low edge, high edge), except the last which also holds its high
+// edge. Values outside the bins and NaNs are not counted.
+
+namespace SVL {
+  namespace detail {
+    // Slots are the bins shifted up by one, with 0 for values below the
+    // first bin and bins + 1 for values above the last bin. NaNs go to
+    // bins + 1 with uniform_bins and to 0 with edge_bins
+
+    //! bins equal width bins between low and high
+    struct uniform_bins {
+      flt low, high, scale;
+      i64 bins;
+      // Slots are only exact as floats up to 2^24
+      static const i64 max_vector_slot = i64(1) << 24;
+      const bool vectorised;
+
+      uniform_bins(flt low, flt high, i64 bins)
+          : low(low), high(high), scale(flt(bins) / (high - low)), bins(bins),
+            vectorised(bins + 1 <= max_vector_slot) {}
+
+      //! Slot of x, matching slots exactly. The clamp is on the whole
+      //! number, as bins - 1 may round up as a float
+      i64 slot(flt x) const {
+        if (!(x <= high)) return bins + 1;
+        if (x < low) return 0;
+        return SVL_MIN(i64(std::floor((x - low) * scale)), bins - 1) + 1;
+      }
+      //! Slots of the elements of x, as floats, for bins + 1 <= max_vector_slot
+      template <typename V>
+      V slots(const V& x) const {
+        V f = min(floor((x - V(low)) * V(scale)), V(flt(bins - 1)));
+        f = blend(V(-1.f), f, x < V(low));
+        return blend(f, V(flt(bins)), x <= V(high)) + V(1.f);
+      }
+    };
+
+    //! Bins between bins + 1 sorted edges
+    struct edge_bins {
+      const flt* edges;
+      i64 bins;
+      // Above this many edges a binary search beats comparing with them all
+      static const i64 max_vector_edges = 64;
+      const bool vectorised;
+
+      edge_bins(const flt* edges, i64 bins)
+          : edges(edges), bins(bins), vectorised(bins + 1 <= max_vector_edges) {}
+
+      //! Slot of x, which is the number of edges at or below x, except that
+      //! x equal to the last edge stays in the last bin
+      i64 slot(flt x) const {
+        if (x != x) return 0;
+        const flt* first = edges;
+        i64 count = bins;
+        while (count > 0) {
+          i64 half = count / 2;
+          if (first[half] <= x) {
+            first += half + 1;
+            count -= half + 1;
+          } else count = half;
+        }
+        return (first - edges) + (x > edges[bins]);
+      }
+      //! Slots of the elements of x, as floats
+      template <typename V>
+      V slots(const V& x) const {
+        const V zero = V::zeros(), one(1.f);
+        V r = zero;
+        for (i64 e = 0; e < bins; ++e) r += blend(one, zero, x >= V(edges[e]));
+        return r + blend(one, zero, x > V(edges[bins]));
+      }
+    };
+
+    //! Add the slots of the n elements of data to slot_counts
+    template <typename V, typename Bins>
+    inline void count_slots(const flt* data, i64 n, const Bins& b, u64* slot_counts) {
+      const i64 ways = 8, stride = b.bins + 2;
+      // Flushed to slot_counts often enough that u32 counts can't overflow
+      const i64 chunk = i64(1) << 31;
+      std::vector<u32> local(ways * stride);
+      flt s[V::step];
+      for (i64 begin = 0; begin < n; begin += chunk) {
+        const i64 end = SVL_MIN(n, begin + chunk);
+        i64 i = begin;
+        if (b.vectorised) {
+          for (; i + V::step <= end; i += V::step) {
+            b.template slots<V>(V(data + i)).store(s);
+            for (i64 l = 0; l < V::step; ++l) ++local[(l % ways) * stride + i64(s[l])];
+          }
+        }
+        for (; i < end; ++i) ++local[b.slot(data[i])];
+        for (i64 w = 0; w < ways; ++w)
+          for (i64 k = 0; k < stride; ++k) slot_counts[k] += local[w * stride + k];
+        std::fill(local.begin(), local.end(), 0u);
+      }
+    }
+
+    //! Write the histogram of data to counts, split over up to threads threads
+    template <typename V, typename Bins>
+    inline void histogram(const flt* data, i64 n, const Bins& b, u64* counts, i64 threads) {
+      if (b.bins <= 0) return;
+      const i64 stride = b.bins + 2;
+      threads = SVL_CLAMP(1, threads, SVL_MAX(1, n / (i64(V::step) * 4096)));
+      std::vector<u64> slot_counts(threads * stride);
+      if (threads == 1) count_slots<V>(data, n, b, slot_counts.data());
+      else {
+        const i64 chunk = (n + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        for (i64 t = 0; t < threads; ++t)
+          workers.emplace_back([&, t]() {
+            i64 begin = SVL_MIN(t * chunk, n), end = SVL_MIN(begin + chunk, n);
+            count_slots<V>(data + begin, end - begin, b, slot_counts.data() + t * stride);
+          });
+        for (std::thread& w : workers) w.join();
+      }
+      for (i64 k = 0; k < b.bins; ++k) {
+        counts[k] = 0;
+        for (i64 t = 0; t < threads; ++t) counts[k] += slot_counts[t * stride + k + 1];
+      }
+    }
+  }
+
+  //! Count the n elements of data into bins equal width bins from low to
+  //! high (low < high), writing the counts to counts[0, bins)
+  template <typename V = Vec8f>
+  inline void histogram(const flt* data, i64 n, flt low, flt high, i64 bins, u64* counts) {
+    detail::histogram<V>(data, n, detail::uniform_bins(low, high, bins), counts, 1);
+  }
+  //! Count the n elements of data into the bins between the n_edges sorted
+  //! edges, writing the counts to counts[0, n_edges - 1)
+  template <typename V = Vec8f>
+  inline void histogram(const flt* data, i64 n, const flt* edges, i64 n_edges, u64* counts) {
+    detail::histogram<V>(data, n, detail::edge_bins(edges, n_edges - 1), counts, 1);
+  }
+
+  //! histogram with equal width bins, split over up to threads threads
+  template <typename V = Vec8f>
+  inline void parallel_histogram(const flt* data, i64 n, flt low, flt high, i64 bins,
+                                 u64* counts, i64 threads = std::thread::hardware_concurrency()) {
+    detail::histogram<V>(data, n, detail::uniform_bins(low, high, bins), counts, threads);
+  }
+  //! histogram with the given edges, split over up to threads threads
+  template <typename V = Vec8f>
+  inline void parallel_histogram(const flt* data, i64 n, const flt* edges, i64 n_edges,
+                                 u64* counts, i64 threads = std::thread::hardware_concurrency()) {
+    detail::histogram<V>(data, n, detail::edge_bins(edges, n_edges - 1), counts, threads);
+  }
+}
@@ -0,0 +1,133 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+// Interpolation in tables of floats. Positions are in table units, so 2.5
+// is halfway between table[2] and table[3], and are clamped to the table
+// (NaN reads as position 0). Positions must be below 2^24 for the indices to
+// be exact. Tables of up to 2 * V::step entries are held in registers and
+// read with lookup, larger ones with gather.
+
+namespace SVL {
+  namespace detail {
+    //! Reads a table of size floats at whole number positions
+    template <typename V>
+    struct table_reader {
+      const flt* table;
+      i64 size;
+      V lo, hi;
+
+      table_reader(const flt* table, i64 size)
+          : table(table), size(size), lo(V::zeros()), hi(V::zeros()) {
+        if (size <= 2 * i64(V::step)) {
+          lo.load_partial(table, size);
+          if (size > V::step) hi.load_partial(table + V::step, size - V::step);
+        }
+      }
+      //! table[index[i]] for whole numbers index[i] in [0, size)
+      V operator()(const V& index) const {
+        if (size <= V::step) return lookup(lo, index);
+        if (size <= 2 * i64(V::step)) {
+          const V s(flt(V::step));
+          return blend(lookup(hi, max(index - s, V::zeros())), lookup(lo, min(index, s - 1.f)),
+                       index >= s);
+        }
+        return gather(table, index);
+      }
+    };
+
+    //! Whole number part of x clamped to a table of n, kept at least one
+    //! below the end, with what is left of x in fraction
+    template <typename V>
+    inline V split_position(const V& x, i64 n, V& fraction) {
+      V clamped = min(max(x, V::zeros()), V(flt(n - 1)));
+      V i = min(floor(clamped), V(flt(SVL_MAX(n - 2, 0))));
+      fraction = clamped - i;
+      return i;
+    }
+
+    template <typename V>
+    inline V lut1d_linear(const table_reader<V>& t, const V& x) {
+      if (t.size == 1) return V(t.table[0]);
+      V f, i = split_position(x, t.size, f);
+      V a = t(i), b = t(i + 1.f);
+      return fma(f, b - a, a);
+    }
+    template <typename V>
+    inline V lut1d_cubic(const table_reader<V>& t, const V& x) {
+      if (t.size == 1) return V(t.table[0]);
+      const V last(flt(t.size - 1));
+      V f, i = split_position(x, t.size, f);
+      V p0 = t(max(i - 1.f, V::zeros())), p1 = t(i), p2 = t(i + 1.f), p3 = t(min(i + 2.f, last));
+      // Catmull-Rom: p1 + f / 2 * (c1 + f * (c2 + f * c3))
+      V c1 = p2 - p0;
+      V c2 = fma(V(4.f), p2, fnma(V(5.f), p1, p0 + p0)) - p3;
+      V c3 = fma(V(3.f), p1 - p2, p3 - p0);
+      return fma(f * 0.5f, fma(fma(c3, f, c2), f, c1), p1);
+    }
+    template <typename V>
+    inline V lut2d_bilinear(const table_reader<V>& t, i64 width, i64 height, const V& x,
+                            const V& y) {
+      V fx, fy;
+      V ix = split_position(x, width, fx), iy = split_position(y, height, fy);
+      // Steps to the next column and row, none if there is only one
+      const V dx(flt(width > 1)), dy(flt(height > 1 ? width : 0));
+      V i = fma(iy, V(flt(width)), ix);
+      V a = t(i), b = t(i + dx), c = t(i + dy), d = t(i + dy + dx);
+      V top = fma(fx, b - a, a), bottom = fma(fx, d - c, c);
+      return fma(fy, bottom - top, top);
+    }
+  }
+
+  //! Linear interpolation at positions x in the n (at least 1) entries of table
+  template <typename V>
+  inline V lut1d_linear(const flt* table, i64 n, const V& x) {
+    return detail::lut1d_linear(detail::table_reader<V>(table, n), x);
+  }
+  //! Catmull-Rom cubic interpolation at positions x in the n (at least 1)
+  //! entries of table, repeating the end entries beyond the table
+  template <typename V>
+  inline V lut1d_cubic(const flt* table, i64 n, const V& x) {
+    return detail::lut1d_cubic(detail::table_reader<V>(table, n), x);
+  }
+  //! Bilinear interpolation at positions (x, y) in the row major table of
+  //! height rows of width entries
+  template <typename V>
+  inline V lut2d_bilinear(const flt* table, i64 width, i64 height, const V& x, const V& y) {
+    return detail::lut2d_bilinear(detail::table_reader<V>(table, width * height), width, height,
+                                  x, y);
+  }
+
+  //! lut1d_linear at the count positions x, writing to out
+  template <typename V = Vec8f>
+  inline void lut1d_linear(flt* out, const flt* x, i64 count, const flt* table, i64 n) {
+    const detail::table_reader<V> t(table, n);
+    for (i64 i = 0; i < count; i += V::step) {
+      const i64 m = SVL_MIN(i64(V::step), count - i);
+      V r = detail::lut1d_linear(t, detail::load_elements<V, false>(x + i, 1, m));
+      detail::store_elements<V, false>(r, out + i, 1, m);
+    }
+  }
+  //! lut1d_cubic at the count positions x, writing to out
+  template <typename V = Vec8f>
+  inline void lut1d_cubic(flt* out, const flt* x, i64 count, const flt* table, i64 n) {
+    const detail::table_reader<V> t(table, n);
+    for (i64 i = 0; i < count; i += V::step) {
+      const i64 m = SVL_MIN(i64(V::step), count - i);
+      V r = detail::lut1d_cubic(t, detail::load_elements<V, false>(x + i, 1, m));
+      detail::store_elements<V, false>(r, out + i, 1, m);
+    }
+  }
+  //! lut2d_bilinear at the count positions (x, y), writing to out
+  template <typename V = Vec8f>
+  inline void lut2d_bilinear(flt* out, const flt* x, const flt* y, i64 count, const flt* table,
+                             i64 width, i64 height) {
+    const detail::table_reader<V> t(table, width * height);
+    for (i64 i = 0; i < count; i += V::step) {
+      const i64 m = SVL_MIN(i64(V::step), count - i);
+      V r = detail::lut2d_bilinear(t, width, height, detail::load_elements<V, false>(x + i, 1, m),
+                                   detail::load_elements<V, false>(y + i, 1, m));
+      detail::store_elements<V, false>(r, out + i, 1, m);
+    }
+  }
+}
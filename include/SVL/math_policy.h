@@ -0,0 +1,645 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+// Accuracy/speed policies for the transcendental functions. Every policy
+// provides sin, cos, sincos, exp, log, atan, tanh, sinh, cosh, erf, erfc,
+// cbrt, lgamma and hypot for any Vector*f type in any of the SIMD namespaces,
+// e.g. SVL::fast::exp(v) or SVL::approx::sin(v).
+//
+//  precise : each element is evaluated with libm in double precision and
+//            rounded once, so results are correctly rounded apart from rare
+//            double rounding cases (max error 0.5 ULP).
+//  fast    : minimax polynomials with Cody-Waite range reduction. Handles
+//            NaN, +-Inf, +-0 and denormals and stays within a few ULP over
+//            the whole float range. sin/cos fall back to precise for
+//            elements with |x| > fast_trig_limit.
+//  approx  : shorter polynomials and a cheaper range reduction. Relative
+//            error is around 2^-16, denormal inputs to log and lgamma are not
+//            supported and sin/cos are only meaningful for |x| <
+//            fast_trig_limit.
+//
+// The hyperbolic functions, erfc and lgamma share the exp and log cores below.
+// Maximum errors measured over the whole float range against glibc in double
+// precision (see test/policy.cpp)
+//
+//            sin       cos       exp       log       atan
+//  precise   0.5 ULP   0.5 ULP   0.5 ULP   0.5 ULP   0.5 ULP
+//  fast      1.5 ULP   1.6 ULP   1.2 ULP   0.8 ULP   2.8 ULP
+//  approx    2^-19     2^-19     2^-17     2^-16     2^-14.5
+//
+//            tanh      sinh      cosh      erf       erfc      cbrt      lgamma
+//  precise   0.5 ULP   0.5 ULP   0.5 ULP   0.5 ULP   0.5 ULP   0.5 ULP   0.5 ULP
+//  fast      1.3 ULP   1.6 ULP   1.5 ULP   1.1 ULP   5.9 ULP   0.5 ULP   3.7 ULP
+//  approx    2^-18.5   2^-17     2^-17.4   2^-20     2^-17.4   2^-18.3   2^-16.5
+//
+// hypot is 0.5 ULP in precise and 1.2 ULP in fast and approx. The approx sin/cos
+// errors are absolute, the other approx errors relative. fast lgamma is quoted
+// for x > 0; for x < 0 and for approx lgamma the error is relative to
+// max(1, |lgamma(x)|) (2^-19 and 2^-16.5), as the zeros there are not exact.
+//
+// The table is for avx2 and scalar, which have a fused fma. The sse fma is a
+// separate multiply and add, so there the range reductions split constants
+// further to keep every product exact, and the extra rounding in the
+// polynomials takes fast sin and cos to 1.9 ULP, erf to 1.2 ULP and cbrt to
+// 0.8 ULP. The approx bounds are the same at every level.
+
+namespace SVL {
+  //! Largest |x| the fast and approx sin/cos reduce themselves
+  static constexpr flt fast_trig_limit = 8192.f;
+
+  namespace detail {
+// Constant of the vector type V being evaluated, loaded from a static table
+#define SVL_K(value) SVL_CONSTANT(V, value)
+
+    //! Apply f to every element of x in double precision
+    template <typename V, typename F>
+    inline V map_double(const V& x, F f) {
+      typename V::scalar_t tmp[V::step];
+      x.store(tmp);
+      SVL_FOR_RANGE(V::step) tmp[i] = (typename V::scalar_t)f((dbl)tmp[i]);
+      return V(tmp);
+    }
+
+    //! Sine and cosine from one Cody-Waite reduction to [-pi/4, pi/4],
+    //! without the fallback for |x| > fast_trig_limit
+    template <bool Approx, typename V>
+    SVL_INLINE void sincos_reduced(const V& x, V& sin_x, V& cos_x) {
+      V q = round(x * 0.636619772367581343f);
+      // pi/2 split so the first two products are exact
+      V r = fnma(q, SVL_K(1.5703125f), x);
+      if (Approx) {
+        r = fnma(q, SVL_K(4.8382673412561417e-4f), r);
+      } else if (V::fused_fma) {
+        r = fnma(q, SVL_K(4.837512969970703125e-4f), r);
+        r = fnma(q, SVL_K(7.5497901264e-8f), r);
+        r = fnma(q, SVL_K(-1.7150994167e-15f), r);
+      } else {
+        // Without a fused fma the third product has to be exact too, so the
+        // rest of pi/2 is split once more
+        r = fnma(q, SVL_K(4.837512969970703125e-4f), r);
+        r = fnma(q, SVL_K(7.54953362047672271728515625e-8f), r);
+        r = fnma(q, SVL_K(2.5633440683e-12f), r);
+      }
+      V r2 = r * r;
+      V s, c;
+      if (Approx) {
+        static constexpr flt sin_poly[] = { -1.6663390398e-1f, 8.1632817164e-3f };
+        static constexpr flt cos_poly[] = { 4.1661277413e-2f, -1.3652449707e-3f };
+        s = fma(r * r2, horner<sin_poly>(r2), r);
+        c = fma(r2 * r2, horner<cos_poly>(r2), fnma(r2, SVL_K(0.5f), SVL_K(1.f)));
+      } else {
+        static constexpr flt sin_poly[] = { -1.6666654611e-1f, 8.3321608736e-3f,
+                                            -1.9515295891e-4f };
+        static constexpr flt cos_poly[] = { 4.166664568298827e-2f, -1.388731625493765e-3f,
+                                            2.443315711809948e-5f };
+        s = fma(horner<sin_poly>(r2) * r2, r, r);
+        c = fma(horner<cos_poly>(r2) * r2, r2, fnma(r2, SVL_K(0.5f), SVL_K(1.f)));
+      }
+      // Quadrant of each element in [0, 3]
+      V quad = q - 4.f * floor(q * 0.25f);
+      auto odd = (quad == SVL_K(1.f)) | (quad == SVL_K(3.f));
+      sin_x = blend(c, s, odd);
+      sin_x = blend(-sin_x, sin_x, quad >= SVL_K(2.f));
+      cos_x = blend(s, c, odd);
+      cos_x = blend(-cos_x, cos_x, (quad == SVL_K(1.f)) | (quad == SVL_K(2.f)));
+      // sin(x) rounds to x for tiny x, which also keeps the sign of zero
+      if (!Approx) sin_x = blend(x, sin_x, abs(x) < SVL_K(2.44140625e-4f));
+    }
+    //! Sine and cosine, falling back to libm beyond fast_trig_limit unless
+    //! Approx
+    template <bool Approx, typename V>
+    inline void sincos(const V& x, V& sin_x, V& cos_x) {
+      sincos_reduced<Approx>(x, sin_x, cos_x);
+      if (!Approx) {
+        auto outside = abs(x) > SVL_K(fast_trig_limit);
+        if (outside.any()) {
+          sin_x = blend(map_double(x, [](dbl v) { return ::sin(v); }), sin_x, outside);
+          cos_x = blend(map_double(x, [](dbl v) { return ::cos(v); }), cos_x, outside);
+        }
+      }
+    }
+    //! Sine, or cosine if Cos, with only that one evaluated by the fallback
+    template <bool Approx, bool Cos, typename V>
+    SVL_INLINE V sincos(const V& x) {
+      V s, c;
+      sincos_reduced<Approx>(x, s, c);
+      V r = Cos ? c : s;
+      if (!Approx) {
+        auto outside = abs(x) > SVL_K(fast_trig_limit);
+        if (outside.any())
+          r = blend(map_double(x, [](dbl v) { return Cos ? ::cos(v) : ::sin(v); }), r, outside);
+      }
+      return r;
+    }
+
+    //! Apply f to every pair of elements of x and y in double precision
+    template <typename V, typename F>
+    inline V map_double(const V& x, const V& y, F f) {
+      typename V::scalar_t a[V::step], b[V::step];
+      x.store(a);
+      y.store(b);
+      SVL_FOR_RANGE(V::step) a[i] = (typename V::scalar_t)f((dbl)a[i], (dbl)b[i]);
+      return V(a);
+    }
+
+    //! Exact error of the rounded product p = a * b. Without a fused fma the
+    //! factors are split in halves that multiply exactly (Dekker)
+    template <typename V>
+    inline V two_product_error(const V& a, const V& b, const V& p) {
+      if constexpr (V::fused_fma) return fma(a, b, -p);
+      else {
+        const V split(4097.f);
+        V ca = split * a, cb = split * b;
+        V a_hi = ca - (ca - a), b_hi = cb - (cb - b);
+        V a_lo = a - a_hi, b_lo = b - b_hi;
+        return (((a_hi * b_hi - p) + a_hi * b_lo) + a_lo * b_hi) + a_lo * b_lo;
+      }
+    }
+
+    //! p * 2^n for whole numbers n, scaling in two steps so denormal and
+    //! overflowing results round once
+    template <typename V>
+    inline V scale_pow2(const V& p, const V& n) {
+      V n1 = floor(n * 0.5f);
+      return p * pow2n(n1) * pow2n(n - n1);
+    }
+
+    //! Exponential split as p * 2^n, with p = exp(r) for |r| <= ln(2) / 2 and
+    //! n a whole number, so callers can adjust n before scaling
+    template <bool Approx, typename V>
+    inline V exp_split(const V& x, V& n) {
+      // Beyond this range the result is 0 or Inf anyway, even scaled by 2^-1
+      V xc = min(SVL_K(90.f), max(SVL_K(-104.f), x));
+      n = round(xc * 1.44269504088896341f);
+      V r, p;
+      if (Approx && V::fused_fma) {
+        r = fnma(n, SVL_K(0.693147180559945309f), xc);
+      } else {
+        // ln(2) split so the first product is exact, which a reduction
+        // without a fused fma needs even for approx
+        r = fnma(n, SVL_K(0.693359375f), xc);
+        r = fnma(n, SVL_K(-2.12194440e-4f), r);
+      }
+      if (Approx) {
+        static constexpr flt exp_poly[] = { 5.0005114079e-1f, 1.6753514111e-1f,
+                                            4.1277747601e-2f };
+        p = horner<exp_poly>(r);
+      } else {
+        static constexpr flt exp_poly[] = { 5.0000001201e-1f, 1.6666665459e-1f,
+                                            4.1665795894e-2f, 8.3334519073e-3f,
+                                            1.3981999507e-3f, 1.9875691500e-4f };
+        p = horner<exp_poly>(r);
+      }
+      return fma(p * r, r, r + 1.f);
+    }
+
+    //! Exponential using 2^n * exp(r) with |r| <= ln(2) / 2
+    template <bool Approx, typename V>
+    inline V exp(const V& x) {
+      V n, p = exp_split<Approx>(x, n);
+      return scale_pow2(p, n);
+    }
+
+    //! Natural logarithm using log(m * 2^e) with m in [sqrt(1/2), sqrt(2))
+    template <bool Approx, typename V>
+    SVL_INLINE V log(const V& x) {
+      V xs = x, e_adjust = V::zeros();
+      if (!Approx) {
+        // Bring denormals into the normal range
+        auto tiny = x < SVL_K(1.17549435e-38f);
+        xs = blend(x * 8388608.f, x, tiny);
+        e_adjust = blend(SVL_K(23.f), V::zeros(), tiny);
+      }
+      V e = exponent(xs) - e_adjust;
+      V m = fraction(xs);
+      auto big = m > SVL_K(1.41421356237309505f);
+      m = blend(m * 0.5f, m, big);
+      e = blend(e + 1.f, e, big);
+      V f = m - 1.f;
+      V z = f * f;
+      V y;
+      if (Approx) {
+        static constexpr flt log_poly[] = { 3.3285471797e-1f, -2.5244998932e-1f,
+                                            2.1776509285e-1f, -1.4592514932e-1f };
+        y = fma(horner<log_poly>(f) * z, f, fnma(z, SVL_K(0.5f), f));
+        y = fma(e, SVL_K(0.693147180559945309f), y);
+      } else {
+        static constexpr flt log_poly[] = { 3.3333331174e-1f, -2.4999993993e-1f,
+                                            2.0000714765e-1f, -1.6668057665e-1f,
+                                            1.4249322787e-1f, -1.2420140846e-1f,
+                                            1.1676998740e-1f, -1.1514610310e-1f,
+                                            7.0376836292e-2f };
+        y = fma(horner<log_poly>(f) * z, f, e * -2.12194440e-4f);
+        y = fnma(z, SVL_K(0.5f), y);
+        y = fma(e, SVL_K(0.693359375f), f + y);
+      }
+      y = blend(SVL_K(-HUGE_VALF), y, x == V::zeros());
+      y = blend(SVL_K(NAN), y, x < V::zeros());
+      return blend(x, y, ~(x < SVL_K(HUGE_VALF)));
+    }
+
+    //! Arctangent reducing |x| to [0, tan(pi/8)] (or [0, 1] when Approx)
+    template <bool Approx, typename V>
+    inline V atan(const V& x) {
+      V t = abs(x);
+      V y0, num, den;
+      if (Approx) {
+        auto big = t > SVL_K(1.f);
+        y0 = blend(SVL_K(1.57079632679489662f), V::zeros(), big);
+        num = blend(SVL_K(-1.f), t, big);
+        den = blend(t, SVL_K(1.f), big);
+      } else {
+        auto big = t > SVL_K(2.41421356237309505f);
+        auto mid = t > SVL_K(0.414213562373095049f);
+        y0 = blend(SVL_K(0.785398163397448310f), V::zeros(), mid);
+        y0 = blend(SVL_K(1.57079632679489662f), y0, big);
+        num = blend(t - 1.f, t, mid);
+        num = blend(SVL_K(-1.f), num, big);
+        den = blend(t + 1.f, SVL_K(1.f), mid);
+        den = blend(t, den, big);
+      }
+      t = num / den;
+      V z = t * t;
+      V y;
+      if (Approx) {
+        static constexpr flt atan_poly[] = { -3.3213073015e-1f, 1.8681417406e-1f,
+                                             -9.4097934663e-2f, 2.4840278551e-2f };
+        y = fma(horner<atan_poly>(z) * z, t, t) + y0;
+      } else {
+        static constexpr flt atan_poly[] = { -3.33329491539e-1f, 1.99777106478e-1f,
+                                             -1.38776856032e-1f, 8.05374449538e-2f };
+        y = fma(horner<atan_poly>(z) * z, t, t) + y0;
+      }
+      y = blend(-y, y, x < V::zeros());
+      if (!Approx) y = blend(x, y, x == V::zeros());
+      return y;
+    }
+
+    //! Hyperbolic sine, a polynomial for |x| < 1 and (e - 1/e) / 2 beyond
+    template <bool Approx, typename V>
+    inline V sinh(const V& x) {
+      static constexpr flt sinh_poly[] = { 1.6666667163e-1f, 8.3333496004e-3f,
+                                           1.9836159481e-4f, 2.8169511097e-6f };
+      V a = abs(x), a2 = a * a;
+      V small = fma(horner<sinh_poly>(a2) * a2, a, a);
+      // e^|x| / 2 straight from the split exponential, so it only overflows
+      // when sinh does
+      V n, p = exp_split<Approx>(a, n);
+      V h = scale_pow2(p, n - 1.f);
+      V big = h - blend(V::zeros(), 0.25f / h, a > SVL_K(16.f));
+      return copysign(blend(small, big, a < SVL_K(1.f)), x);
+    }
+
+    //! Hyperbolic cosine as (e + 1/e) / 2
+    template <bool Approx, typename V>
+    inline V cosh(const V& x) {
+      V a = abs(x);
+      V n, p = exp_split<Approx>(a, n);
+      V h = scale_pow2(p, n - 1.f);
+      return h + blend(V::zeros(), 0.25f / h, a > SVL_K(16.f));
+    }
+
+    //! Hyperbolic tangent, a polynomial for |x| < 0.625 and 1 - 2 / (e^2x + 1)
+    //! beyond
+    template <bool Approx, typename V>
+    inline V tanh(const V& x) {
+      static constexpr flt tanh_poly[] = { -3.3333331347e-1f, 1.3333205879e-1f,
+                                           -5.3946763277e-2f, 2.1700702608e-2f,
+                                           -8.1773987040e-3f, 2.1429620683e-3f };
+      V a = abs(x), a2 = a * a;
+      V small = fma(horner<tanh_poly>(a2) * a2, a, a);
+      V big = 1.f - 2.f / (exp<Approx>(a + a) + 1.f);
+      big = blend(SVL_K(1.f), big, a > SVL_K(10.f));
+      return copysign(blend(small, big, a < SVL_K(0.625f)), x);
+    }
+
+    //! erf(x) / x - 1 as a polynomial in x^2, for |x| < 1
+    template <typename V>
+    inline V erf_small(const V& x2) {
+      static constexpr flt erf_poly[] = { 1.2837916613e-1f, -3.7612625957e-1f,
+                                          1.1283585429e-1f, -2.6853812858e-2f,
+                                          5.1883296110e-3f, -8.0102088396e-4f,
+                                          7.8539073002e-5f };
+      return estrin<erf_poly>(x2);
+    }
+
+    //! erfc(a) for a >= 0.46875 as exp(-a^2) R(a), with R a polynomial in
+    //! 1 / (1 + a / 2). a^2 is kept as a rounded square plus its exact error
+    //! so the exponential sees all of it, and the result is scaled once at
+    //! the end so denormal results round once
+    template <bool Approx, typename V>
+    inline V erfc_tail(const V& a) {
+      static constexpr flt erfc_poly[] = { 3.7727702420e-6f, 2.8197863698e-1f,
+                                           2.8365775943e-1f, 2.3474675417e-1f,
+                                           2.3565439880e-1f, -1.0857910663e-1f,
+                                           4.0699058771e-1f, -6.1150997877e-1f,
+                                           3.5153049231e-1f, -7.4481368065e-2f };
+      V r = estrin<erfc_poly>(1.f / fma(a, SVL_K(0.5f), SVL_K(1.f)));
+      V sq = a * a, err = two_product_error(a, a, sq);
+      V n, p = exp_split<Approx>(-sq, n);
+      // exp(-sq - err) = exp(-sq) (1 - err) as err is below 2^-17
+      V res = scale_pow2(p * fnma(r, err, r), n);
+      // Also keeps out the NaN error of an infinite square
+      return blend(V::zeros(), res, a > SVL_K(10.1f));
+    }
+
+    //! Error function, a polynomial for |x| < 1 and 1 - erfc(|x|) beyond
+    template <bool Approx, typename V>
+    inline V erf(const V& x) {
+      V a = abs(x);
+      V small = fma(erf_small(a * a), a, a);
+      V big = 1.f - erfc_tail<Approx>(a);
+      return copysign(blend(small, big, a < SVL_K(1.f)), x);
+    }
+
+    //! Complementary error function. 1 - erf(x) while the result is above
+    //! 1/2, so there is no cancellation, and the exp(-x^2) form beyond
+    template <bool Approx, typename V>
+    inline V erfc(const V& x) {
+      V a = abs(x);
+      V small = 1.f - copysign(fma(erf_small(a * a), a, a), x);
+      V tail = erfc_tail<Approx>(a);
+      V r = blend(tail, small, x >= SVL_K(0.46875f));
+      return blend(2.f - tail, r, x <= SVL_K(-1.f));
+    }
+
+    //! Cube root of m * 2^e, with e split into 3q + r and cbrt(m * 2^r) for
+    //! m * 2^r in [1, 8) refined from a quadratic by Halley's method
+    template <bool Approx, typename V>
+    inline V cbrt(const V& x) {
+      static constexpr flt cbrt_poly[] = { 7.6250332594e-1f, 2.6807498932e-1f,
+                                           -1.4670588076e-2f };
+      V a = abs(x);
+      // Bring denormals into the normal range, 2^24 has a whole cube root
+      auto tiny = a < SVL_K(1.17549435e-38f);
+      V s = blend(a * 16777216.f, a, tiny);
+      V e = exponent(s) - blend(SVL_K(24.f), V::zeros(), tiny);
+      V q = floor((e + 0.5f) * (1.f / 3.f));
+      V m = fraction(s) * pow2n(e - 3.f * q);
+      V y = horner<cbrt_poly>(m);
+      // Each Halley step triples the number of correct bits, 6 to 18 to all
+      V y3 = y * y * y;
+      y *= (y3 + m + m) / (y3 + y3 + m);
+      if (!Approx) {
+        y3 = y * y * y;
+        y *= (y3 + m + m) / (y3 + y3 + m);
+        // Newton step on the exact residual y^3 - m rounds the last bit
+        V y2 = y * y, y2_err = two_product_error(y, y, y2);
+        V res = fma(y2, y, -m) + y2_err * y;
+        y = fnma(res / (3.f * y2), SVL_K(1.f), y);
+      }
+      V r = copysign(y * pow2n(q), x);
+      return blend(x, r, (a == V::zeros()) | ~(a < SVL_K(HUGE_VALF)));
+    }
+
+    //! sqrt(x^2 + y^2) with both scaled by the exponent of the larger so the
+    //! squares never overflow or underflow. Infinite if either is, even when
+    //! the other is NaN
+    template <typename V>
+    inline V hypot(const V& x, const V& y) {
+      V ax = abs(x), ay = abs(y);
+      V a = max(ax, ay), b = min(ax, ay);
+      V e = min(max(exponent(a), SVL_K(-126.f)), SVL_K(126.f));
+      V s = pow2n(-e);
+      V as = a * s, bs = b * s;
+      V r = sqrt(fma(as, as, bs * bs)) * pow2n(e);
+      r = blend(SVL_K(NAN), r, isnan(x) | isnan(y));
+      return blend(SVL_K(HUGE_VALF), r, isinf(x) | isinf(y));
+    }
+
+    //! Log gamma, by Stirling's series for x >= 8. Smaller x are moved into
+    //! [1.2, 2.5) with the recurrence and use a polynomial about 2 that
+    //! keeps the zeros at 1 and 2 exact. Negative x use the reflection
+    //! formula, so their error is absolute near the zeros there
+    template <bool Approx, typename V>
+    inline V lgamma(const V& x) {
+      static constexpr flt lgamma_poly[] = { 4.2278432846e-1f, 3.2246702909e-1f,
+                                             -6.7352280021e-2f, 2.0580744371e-2f,
+                                             -7.3862350546e-3f, 2.8910050169e-3f,
+                                             -1.1855772464e-3f, 5.1143782912e-4f,
+                                             -2.5407545036e-4f, 7.3156290455e-5f,
+                                             -4.9734956065e-7f, 8.1742553448e-5f };
+      auto neg = x < V::zeros();
+      V w = blend(1.f - x, x, neg);
+      // lgamma(w) = lgamma(w - k) + log((w - 1) ... (w - k)) moving down
+      V z = w, down = SVL_K(1.f), centre = SVL_K(2.f);
+      for (int j = 0; j < 6; ++j) {
+        auto m = z >= SVL_K(2.5f);
+        z = blend(z - 1.f, z, m);
+        down = blend(down * z, down, m);
+        centre = blend(centre + 1.f, centre, m);
+      }
+      // and lgamma(w) = lgamma(w + k) - log(w ... (w + k - 1)) moving up
+      auto below = w < SVL_K(1.2f), far_below = w < SVL_K(0.5f);
+      V up = blend(fma(w, w, w), w, far_below);
+      centre = centre - blend(SVL_K(1.f), V::zeros(), below) - blend(SVL_K(1.f), V::zeros(), far_below);
+      auto stirling = w >= SVL_K(8.f);
+      V l = log<Approx>(blend(w, blend(up, down, below), stirling));
+      // w - centre is exact and in [-0.8, 0.5)
+      V t = w - centre;
+      V res = fma(t, estrin<lgamma_poly>(t), blend(-l, l, below));
+      // (w - 1/2) log(w) - w + log(2 pi) / 2 + 1 / 12w - 1 / 360w^3 + 1 / 1260w^5
+      V iw = 1.f / w, iw2 = iw * iw;
+      V series = iw * fma(iw2, fma(iw2, SVL_K(7.9365079365e-4f), SVL_K(-2.7777777778e-3f)),
+                          SVL_K(8.3333333333e-2f));
+      V big = fma(w - 0.5f, l - 1.f, series + SVL_K(4.1893853320e-1f));
+      res = blend(big, res, stirling);
+      if (neg.any()) {
+        // lgamma(x) = log(pi / |sin(pi x)|) - lgamma(1 - x), with the sine of
+        // the distance to the nearest whole number
+        V r = x - round(x);
+        V sinpi = abs(sincos<Approx, false>(r * 3.14159265358979324f));
+        V refl = -log<Approx>(sinpi * 0.318309886183790672f) - res;
+        // Poles at the negative whole numbers, and lgamma(-inf) = inf
+        refl = blend(SVL_K(HUGE_VALF), refl, (r == V::zeros()) | isinf(x));
+        res = blend(refl, res, neg);
+      }
+      return res;
+    }
+#undef SVL_K
+  }
+
+  //! Correctly rounded (max 0.5 ULP) versions evaluated in double precision
+  namespace precise {
+    //! Sine of all elements in x
+    template <typename V> inline V sin(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::sin(v); });
+    }
+    //! Cosine of all elements in x
+    template <typename V> inline V cos(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::cos(v); });
+    }
+    //! Sine and cosine of all elements in x
+    template <typename V> inline void sincos(const V& x, V& sin_x, V& cos_x) {
+      sin_x = sin(x);
+      cos_x = cos(x);
+    }
+    //! Exponential of all elements in x
+    template <typename V> inline V exp(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::exp(v); });
+    }
+    //! Natural logarithm of all elements in x
+    template <typename V> inline V log(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::log(v); });
+    }
+    //! Arctangent of all elements in x
+    template <typename V> inline V atan(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::atan(v); });
+    }
+    //! Hyperbolic tangent of all elements in x
+    template <typename V> inline V tanh(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::tanh(v); });
+    }
+    //! Hyperbolic sine of all elements in x
+    template <typename V> inline V sinh(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::sinh(v); });
+    }
+    //! Hyperbolic cosine of all elements in x
+    template <typename V> inline V cosh(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::cosh(v); });
+    }
+    //! Error function of all elements in x
+    template <typename V> inline V erf(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::erf(v); });
+    }
+    //! Complementary error function of all elements in x
+    template <typename V> inline V erfc(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::erfc(v); });
+    }
+    //! Cube root of all elements in x
+    template <typename V> inline V cbrt(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::cbrt(v); });
+    }
+    //! Log of the absolute value of the gamma function of all elements in x
+    template <typename V> inline V lgamma(const V& x) {
+      return detail::map_double(x, [](dbl v) { return ::lgamma(v); });
+    }
+    //! sqrt(x^2 + y^2) of all elements of x and y without overflow
+    template <typename V> inline V hypot(const V& x, const V& y) {
+      return detail::map_double(x, y, [](dbl a, dbl b) { return ::hypot(a, b); });
+    }
+  }
+
+  //! Polynomial versions accurate to a few ULP over the whole float range
+  namespace fast {
+    //! Sine of all elements in x
+    template <typename V> SVL_INLINE V sin(const V& x) {
+      return detail::sincos<false, false>(x);
+    }
+    //! Cosine of all elements in x
+    template <typename V> SVL_INLINE V cos(const V& x) {
+      return detail::sincos<false, true>(x);
+    }
+    //! Sine and cosine of all elements in x, sharing the range reduction
+    template <typename V> SVL_INLINE void sincos(const V& x, V& sin_x, V& cos_x) {
+      detail::sincos<false>(x, sin_x, cos_x);
+    }
+    //! Exponential of all elements in x
+    template <typename V> SVL_INLINE V exp(const V& x) {
+      return detail::exp<false>(x);
+    }
+    //! Natural logarithm of all elements in x
+    template <typename V> SVL_INLINE V log(const V& x) {
+      return detail::log<false>(x);
+    }
+    //! Arctangent of all elements in x
+    template <typename V> SVL_INLINE V atan(const V& x) {
+      return detail::atan<false>(x);
+    }
+    //! Hyperbolic tangent of all elements in x
+    template <typename V> SVL_INLINE V tanh(const V& x) {
+      return detail::tanh<false>(x);
+    }
+    //! Hyperbolic sine of all elements in x
+    template <typename V> SVL_INLINE V sinh(const V& x) {
+      return detail::sinh<false>(x);
+    }
+    //! Hyperbolic cosine of all elements in x
+    template <typename V> SVL_INLINE V cosh(const V& x) {
+      return detail::cosh<false>(x);
+    }
+    //! Error function of all elements in x
+    template <typename V> SVL_INLINE V erf(const V& x) {
+      return detail::erf<false>(x);
+    }
+    //! Complementary error function of all elements in x
+    template <typename V> SVL_INLINE V erfc(const V& x) {
+      return detail::erfc<false>(x);
+    }
+    //! Cube root of all elements in x
+    template <typename V> SVL_INLINE V cbrt(const V& x) {
+      return detail::cbrt<false>(x);
+    }
+    //! Log of the absolute value of the gamma function of all elements in x
+    template <typename V> SVL_INLINE V lgamma(const V& x) {
+      return detail::lgamma<false>(x);
+    }
+    //! sqrt(x^2 + y^2) of all elements of x and y without overflow
+    template <typename V> SVL_INLINE V hypot(const V& x, const V& y) {
+      return detail::hypot(x, y);
+    }
+  }
+
+  //! Low degree versions with a relative error around 2^-16
+  namespace approx {
+    //! Sine of all elements in x, for |x| < fast_trig_limit
+    template <typename V> SVL_INLINE V sin(const V& x) {
+      return detail::sincos<true, false>(x);
+    }
+    //! Cosine of all elements in x, for |x| < fast_trig_limit
+    template <typename V> SVL_INLINE V cos(const V& x) {
+      return detail::sincos<true, true>(x);
+    }
+    //! Sine and cosine of all elements in x, for |x| < fast_trig_limit,
+    //! sharing the range reduction
+    template <typename V> SVL_INLINE void sincos(const V& x, V& sin_x, V& cos_x) {
+      detail::sincos<true>(x, sin_x, cos_x);
+    }
+    //! Exponential of all elements in x
+    template <typename V> SVL_INLINE V exp(const V& x) {
+      return detail::exp<true>(x);
+    }
+    //! Natural logarithm of all elements in x, denormal inputs not supported
+    template <typename V> SVL_INLINE V log(const V& x) {
+      return detail::log<true>(x);
+    }
+    //! Arctangent of all elements in x
+    template <typename V> SVL_INLINE V atan(const V& x) {
+      return detail::atan<true>(x);
+    }
+    //! Hyperbolic tangent of all elements in x
+    template <typename V> SVL_INLINE V tanh(const V& x) {
+      return detail::tanh<true>(x);
+    }
+    //! Hyperbolic sine of all elements in x
+    template <typename V> SVL_INLINE V sinh(const V& x) {
+      return detail::sinh<true>(x);
+    }
+    //! Hyperbolic cosine of all elements in x
+    template <typename V> SVL_INLINE V cosh(const V& x) {
+      return detail::cosh<true>(x);
+    }
+    //! Error function of all elements in x
+    template <typename V> SVL_INLINE V erf(const V& x) {
+      return detail::erf<true>(x);
+    }
+    //! Complementary error function of all elements in x
+    template <typename V> SVL_INLINE V erfc(const V& x) {
+      return detail::erfc<true>(x);
+    }
+    //! Cube root of all elements in x
+    template <typename V> SVL_INLINE V cbrt(const V& x) {
+      return detail::cbrt<true>(x);
+    }
+    //! Log of the absolute value of the gamma function of all elements in x,
+    //! denormal inputs not supported
+    template <typename V> SVL_INLINE V lgamma(const V& x) {
+      return detail::lgamma<true>(x);
+    }
+    //! sqrt(x^2 + y^2) of all elements of x and y, the same as fast::hypot
+    template <typename V> SVL_INLINE V hypot(const V& x, const V& y) {
+      return detail::hypot(x, y);
+    }
+  }
+}
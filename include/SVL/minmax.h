@@ -0,0 +1,169 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <thread>
+#include <vector>
+
+// Positions of the smallest and largest elements of arrays of floats. Each
+// lane keeps its best value and the block it came from, updated with a
+// compare and blend per vector, and the lanes are only combined at the end.
+// Ties give the first position.
+
+namespace SVL {
+  //! How the array reductions treat NaNs
+  enum class nan_policy {
+    //! Skip NaNs, as if they were not in the array
+    ignore,
+    //! The first NaN is the result
+    propagate
+  };
+
+  namespace detail {
+    //! Best value and its index, -1 if there is none
+    struct extreme {
+      flt value;
+      i64 index;
+    };
+
+    //! True if a at index ia should replace the current best b at ib
+    template <bool is_max>
+    inline bool better(flt a, i64 ia, const extreme& b, nan_policy nans) {
+      bool a_nan = a != a, b_nan = b.value != b.value;
+      if (a_nan && nans == nan_policy::ignore) return false;
+      if (b.index < 0) return true;
+      if (a_nan || b_nan) return a_nan && (!b_nan || ia < b.index);
+      if (a == b.value) return ia < b.index;
+      return is_max ? a > b.value : a < b.value;
+    }
+
+    //! Lanes where x should replace best, ignoring ties as x comes later
+    template <bool is_max, typename V>
+    inline typename V::bool_t improves(const V& x, const V& best, nan_policy nans) {
+      typename V::bool_t take = is_max ? x > best : x < best;
+      if (nans == nan_policy::ignore) return take | and_not(x != x, best != best);
+      return take | and_not(best != best, x != x);
+    }
+
+    //! Elements as they are
+    struct identity {
+      template <typename T>
+      T operator()(const T& x) const { return x; }
+    };
+
+    //! Minimum and maximum of op applied to data[begin, end), as requested.
+    //! op takes both a flt and a V
+    template <typename V, bool find_min, bool find_max, typename Op = identity>
+    inline std::pair<extreme, extreme> find_extremes(const flt* data, i64 begin, i64 end,
+                                                     nan_policy nans, Op op = Op()) {
+      extreme lo{ 0.f, -1 }, hi{ 0.f, -1 };
+      // Block numbers are counted in floats, which are exact up to 2^24
+      const i64 chunk = i64(V::step) << 24;
+      i64 i = begin;
+      while (i + V::step <= end) {
+        const i64 chunk_begin = i, chunk_end = SVL_MIN(end, i + chunk);
+        const V one(1.f);
+        V min_value = op(V(data + i)), max_value = min_value;
+        V min_block = V::zeros(), max_block = V::zeros(), block = V::zeros();
+        for (i += V::step; i + V::step <= chunk_end; i += V::step) {
+          block += one;
+          V x = op(V(data + i));
+          if constexpr (find_min) {
+            typename V::bool_t take = improves<false>(x, min_value, nans);
+            min_value = blend(x, min_value, take);
+            min_block = blend(block, min_block, take);
+          }
+          if constexpr (find_max) {
+            typename V::bool_t take = improves<true>(x, max_value, nans);
+            max_value = blend(x, max_value, take);
+            max_block = blend(block, max_block, take);
+          }
+        }
+        flt values[V::step], blocks[V::step];
+        auto reduce = [&](const V& value, const V& block, extreme& r, auto is_max) {
+          value.store(values);
+          block.store(blocks);
+          for (i64 l = 0; l < V::step; ++l) {
+            i64 index = chunk_begin + i64(blocks[l]) * V::step + l;
+            if (better<decltype(is_max)::value>(values[l], index, r, nans)) r = { values[l], index };
+          }
+        };
+        if constexpr (find_min) reduce(min_value, min_block, lo, std::false_type());
+        if constexpr (find_max) reduce(max_value, max_block, hi, std::true_type());
+      }
+      for (; i < end; ++i) {
+        flt x = op(data[i]);
+        if (find_min && better<false>(x, i, lo, nans)) lo = { x, i };
+        if (find_max && better<true>(x, i, hi, nans)) hi = { x, i };
+      }
+      return { lo, hi };
+    }
+
+    //! find_extremes split over up to threads threads, combined in order
+    template <typename V, bool find_min, bool find_max>
+    inline std::pair<extreme, extreme> parallel_find_extremes(const flt* data, i64 n,
+                                                              nan_policy nans, i64 threads) {
+      threads = SVL_CLAMP(1, threads, SVL_MAX(1, n / (i64(V::step) * 4096)));
+      // Whole numbers of vectors per thread
+      i64 chunk = (n / threads + V::step - 1) / V::step * V::step;
+      std::vector<std::pair<extreme, extreme>> results(threads);
+      std::vector<std::thread> workers;
+      for (i64 t = 0; t < threads; ++t)
+        workers.emplace_back([&, t]() {
+          i64 begin = SVL_MIN(t * chunk, n), end = SVL_MIN(begin + chunk, n);
+          results[t] = find_extremes<V, find_min, find_max>(data, begin, end, nans);
+        });
+      for (std::thread& w : workers) w.join();
+      std::pair<extreme, extreme> r = results[0];
+      for (i64 t = 1; t < threads; ++t) {
+        const extreme& lo = results[t].first;
+        const extreme& hi = results[t].second;
+        if (lo.index >= 0 && better<false>(lo.value, lo.index, r.first, nans)) r.first = lo;
+        if (hi.index >= 0 && better<true>(hi.value, hi.index, r.second, nans)) r.second = hi;
+      }
+      return r;
+    }
+  }
+
+  //! Index of the first smallest of the n elements of data, or -1 if there
+  //! are none (n is 0, or all are NaN and nans is ignore)
+  template <typename V = Vec8f>
+  inline i64 argmin(const flt* data, i64 n, nan_policy nans = nan_policy::ignore) {
+    return detail::find_extremes<V, true, false>(data, 0, n, nans).first.index;
+  }
+  //! Index of the first largest of the n elements of data, or -1 if there
+  //! are none (n is 0, or all are NaN and nans is ignore)
+  template <typename V = Vec8f>
+  inline i64 argmax(const flt* data, i64 n, nan_policy nans = nan_policy::ignore) {
+    return detail::find_extremes<V, false, true>(data, 0, n, nans).second.index;
+  }
+  //! Indices of the first smallest and first largest of the n elements of
+  //! data, found in a single pass. Both are -1 if there are none
+  template <typename V = Vec8f>
+  inline std::pair<i64, i64> minmax_element(const flt* data, i64 n,
+                                            nan_policy nans = nan_policy::ignore) {
+    auto r = detail::find_extremes<V, true, true>(data, 0, n, nans);
+    return { r.first.index, r.second.index };
+  }
+
+  //! argmin split over up to threads threads
+  template <typename V = Vec8f>
+  inline i64 parallel_argmin(const flt* data, i64 n, nan_policy nans = nan_policy::ignore,
+                             i64 threads = std::thread::hardware_concurrency()) {
+    return detail::parallel_find_extremes<V, true, false>(data, n, nans, threads).first.index;
+  }
+  //! argmax split over up to threads threads
+  template <typename V = Vec8f>
+  inline i64 parallel_argmax(const flt* data, i64 n, nan_policy nans = nan_policy::ignore,
+                             i64 threads = std::thread::hardware_concurrency()) {
+    return detail::parallel_find_extremes<V, false, true>(data, n, nans, threads).second.index;
+  }
+  //! minmax_element split over up to threads threads
+  template <typename V = Vec8f>
+  inline std::pair<i64, i64> parallel_minmax_element(const flt* data, i64 n,
+                                                     nan_policy nans = nan_policy::ignore,
+                                                     i64 threads = std::thread::hardware_concurrency()) {
+    auto r = detail::parallel_find_extremes<V, true, true>(data, n, nans, threads);
+    return { r.first.index, r.second.index };
+  }
+}
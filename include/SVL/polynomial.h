@@ -0,0 +1,92 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <iterator>  // for std::size
+
+// Polynomial evaluation for any Vector*f type in any of the SIMD namespaces.
+// Compile time coefficients are a constexpr array of floats, lowest power
+// first, each loaded as an SVL_CONSTANT table, e.g.
+//   static constexpr flt curve[] = { 1.f, 0.5f, 0.25f };  // 1 + x/2 + x^2/4
+//   y = SVL::polyval<curve>(x);
+// horner needs the fewest operations but is one long chain of fmas. estrin
+// splits the polynomial into independent halves joined by x^2, x^4, ...,
+// so its chain is only about log2 of the degree long.
+
+namespace SVL {
+  namespace detail {
+    //! C[i] + x * (C[i + 1] + x * (...))
+    template <const auto& C, i64 i, typename V>
+    SVL_INLINE V horner_from(const V& x) {
+      if constexpr (i + 1 == i64(std::size(C))) return SVL_CONSTANT(V, C[i]);
+      else return fma(horner_from<C, i + 1>(x), x, SVL_CONSTANT(V, C[i]));
+    }
+
+    //! Largest power of two below n, for n > 1
+    constexpr i64 estrin_split(i64 n) {
+      i64 p = 1;
+      while (p * 2 < n) p *= 2;
+      return p;
+    }
+    //! k where 2^k is the power of two p
+    constexpr i64 estrin_level(i64 p) {
+      i64 k = 0;
+      while ((i64(1) << k) < p) ++k;
+      return k;
+    }
+    //! C[begin] + C[begin + 1] x + ... with len terms, where powers[k] is x^(2^k)
+    template <const auto& C, i64 begin, i64 len, typename V>
+    SVL_INLINE V estrin_part(const V* powers) {
+      if constexpr (len == 1) return SVL_CONSTANT(V, C[begin]);
+      else {
+        constexpr i64 half = estrin_split(len);
+        return fma(estrin_part<C, begin + half, len - half>(powers), powers[estrin_level(half)],
+                   estrin_part<C, begin, half>(powers));
+      }
+    }
+  }
+
+  //! C[0] + C[1] x + C[2] x^2 + ... by Horner's rule
+  template <const auto& C, typename V>
+  SVL_INLINE V horner(const V& x) {
+    static_assert(std::size(C) > 0, "A polynomial needs at least one coefficient");
+    return detail::horner_from<C, 0>(x);
+  }
+  //! C[0] + C[1] x + C[2] x^2 + ... by Estrin's scheme
+  template <const auto& C, typename V>
+  SVL_INLINE V estrin(const V& x) {
+    constexpr i64 n = std::size(C);
+    static_assert(n > 0, "A polynomial needs at least one coefficient");
+    V powers[detail::estrin_level(n) + 1];
+    powers[0] = x;
+    for (i64 k = 1; k <= detail::estrin_level(n); ++k) powers[k] = powers[k - 1] * powers[k - 1];
+    return detail::estrin_part<C, 0, n>(powers);
+  }
+  //! C[0] + C[1] x + C[2] x^2 + ..., by Horner's rule for up to three
+  //! coefficients and Estrin's scheme beyond
+  template <const auto& C, typename V>
+  SVL_INLINE V polyval(const V& x) {
+    if constexpr (std::size(C) <= 3) return horner<C>(x);
+    else return estrin<C>(x);
+  }
+  //! c[0] + c[1] x + ... + c[n - 1] x^(n - 1) by Horner's rule, for
+  //! coefficients only known at run time
+  template <typename V>
+  inline V polyval(const V& x, const flt* c, i64 n) {
+    if (n <= 0) return V::zeros();
+    V r(c[n - 1]);
+    for (i64 i = n - 2; i >= 0; --i) r = fma(r, x, V(c[i]));
+    return r;
+  }
+
+  //! P(x) / Q(x) for compile time coefficients, as for polyval
+  template <const auto& P, const auto& Q, typename V>
+  SVL_INLINE V rational(const V& x) {
+    return polyval<P>(x) / polyval<Q>(x);
+  }
+  //! P(x) / Q(x) for the np coefficients p and nq coefficients q
+  template <typename V>
+  inline V rational(const V& x, const flt* p, i64 np, const flt* q, i64 nq) {
+    return polyval(x, p, np) / polyval(x, q, nq);
+  }
+}
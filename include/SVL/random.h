@@ -0,0 +1,158 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+// Pseudo random floats from xoshiro256+ generators, one per 64 bit lane of
+// V::bits_t, so each output gives two floats. Uniform floats take 23 bits
+// of a 32 bit half as the mantissa of a number in [1, 2), and normal ones
+// come in pairs from the Box-Muller transform using the fast policy's log
+// and sincos.
+//
+// The lanes start 2^128 steps apart on the same sequence, and long_jump
+// moves them all 2^192 steps along, so generators made with different
+// stream numbers (e.g. one per thread) never overlap.
+
+namespace SVL {
+  namespace detail {
+    //! splitmix64, for expanding a seed into generator states
+    inline u64 splitmix64(u64& x) {
+      u64 z = (x += 0x9E3779B97F4A7C15ull);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+
+    //! Polynomials advancing xoshiro256 by 2^128 and 2^192 steps
+    static const u64 xoshiro_jump[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                         0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+    static const u64 xoshiro_long_jump[4] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull,
+                                              0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+
+    //! Step the xoshiro256 state s, of u64s or vectors of them
+    template <typename U>
+    inline void xoshiro_step(U* s) {
+      const U t = s[1] << 17;
+      s[2] = s[2] ^ s[0];
+      s[3] = s[3] ^ s[1];
+      s[1] = s[1] ^ s[2];
+      s[0] = s[0] ^ s[3];
+      s[2] = s[2] ^ t;
+      s[3] = (s[3] << 45) | (s[3] >> 19);
+    }
+
+    //! Advance the xoshiro256 state s by the steps given by polynomial
+    template <typename U>
+    inline void xoshiro_advance(U* s, const u64* polynomial) {
+      U t[4] = { U(u64(0)), U(u64(0)), U(u64(0)), U(u64(0)) };
+      for (i64 i = 0; i < 4; ++i)
+        for (i64 b = 0; b < 64; ++b) {
+          if (polynomial[i] & (u64(1) << b))
+            for (i64 j = 0; j < 4; ++j) t[j] = t[j] ^ s[j];
+          xoshiro_step(s);
+        }
+      for (i64 j = 0; j < 4; ++j) s[j] = t[j];
+    }
+  }
+
+  //! Generator of V::step pseudo random floats at a time
+  template <typename V = Vec8f>
+  struct Random {
+    using bits_t = typename V::bits_t;
+    static_assert(sizeof(bits_t) == sizeof(V), "Each 64 bit lane must give two floats");
+
+    //! xoshiro256 state, a generator in each lane
+    bits_t s[4];
+    //! The second of the last pair of normal samples, if not used yet
+    V spare;
+    bool has_spare = false;
+
+    //! Lanes seeded from seed, then moved stream long jumps along
+    explicit Random(u64 seed, i64 stream = 0) {
+      u64 lane[4];
+      for (u64& x : lane) x = detail::splitmix64(seed);
+      u64 states[4][bits_t::step];
+      for (i64 l = 0; l < bits_t::step; ++l) {
+        for (i64 j = 0; j < 4; ++j) states[j][l] = lane[j];
+        detail::xoshiro_advance(lane, detail::xoshiro_jump);
+      }
+      for (i64 j = 0; j < 4; ++j) s[j] = bits_t(states[j]);
+      for (i64 i = 0; i < stream; ++i) long_jump();
+    }
+
+    //! Move every lane 2^192 steps along
+    void long_jump() {
+      detail::xoshiro_advance(s, detail::xoshiro_long_jump);
+      has_spare = false;
+    }
+
+    //! The next 64 random bits from each lane
+    bits_t next_bits() {
+      const bits_t result = s[0] + s[3];
+      detail::xoshiro_step(s);
+      return result;
+    }
+    //! Uniform samples in [1, 2), multiples of 2^-23. The lowest bits of
+    //! xoshiro256+ are its weakest, so each float takes the top 23 bits of
+    //! a 32 bit half
+    V one_to_two() {
+      const bits_t mantissas = (next_bits() >> 9) & bits_t(u64(0x007FFFFF007FFFFFull));
+      return __builtin_bit_cast(V, mantissas | bits_t(u64(0x3F8000003F800000ull)));
+    }
+    //! Uniform samples in [0, 1), multiples of 2^-23
+    V uniform() { return one_to_two() - V(1.f); }
+    //! Uniform samples between low and high
+    V uniform(flt low, flt high) { return fma(uniform(), V(high - low), V(low)); }
+    //! Standard normal samples
+    V normal() {
+      if (has_spare) {
+        has_spare = false;
+        return spare;
+      }
+      V z;
+      normal_pair(z, spare);
+      has_spare = true;
+      return z;
+    }
+
+    //! Fill out with n uniform samples between low and high
+    void fill_uniform(i64 n, flt* out, flt low = 0.f, flt high = 1.f) {
+      // From [1, 2) in one multiply add
+      const V scale(high - low), offset(low - (high - low));
+      i64 i = 0;
+      for (; i + i64(V::step) <= n; i += V::step) fma(one_to_two(), scale, offset).store(out + i);
+      if (i < n) fma(one_to_two(), scale, offset).store_partial(out + i, n - i);
+    }
+    //! Fill out with n normal samples of mean and standard deviation stddev
+    void fill_normal(i64 n, flt* out, flt mean = 0.f, flt stddev = 1.f) {
+      const V m(mean), sd(stddev);
+      V z0, z1;
+      i64 i = 0;
+      for (; i + 2 * i64(V::step) <= n; i += 2 * V::step) {
+        normal_pair(z0, z1);
+        fma(z0, sd, m).store(out + i);
+        fma(z1, sd, m).store(out + i + V::step);
+      }
+      if (i < n) {
+        normal_pair(z0, z1);
+        fma(z0, sd, m).store_partial(out + i, n - i);
+        if (n - i > i64(V::step)) fma(z1, sd, m).store_partial(out + i + V::step, n - i - V::step);
+      }
+    }
+
+   private:
+    //! Two registers of independent standard normal samples
+    void normal_pair(V& z0, V& z1) {
+      // The radius from u in (0, 1] with 46 random bits, so the tails reach
+      // out to 8 standard deviations rather than the 5.6 of 23 bits
+      const V fine = (one_to_two() - V(1.f - 0x1p-23f)) * V(0x1p-23f);
+      const V u = uniform() + fine;
+      const V r = sqrt(V(-2.f) * fast::log(u));
+      // Angles in [-pi, pi), where the reduction for sincos is cheapest
+      const V angle = fma(one_to_two(), V(6.28318530718f), V(-9.42477796077f));
+      V sin_a, cos_a;
+      fast::sincos(angle, sin_a, cos_a);
+      z0 = r * cos_a;
+      z1 = r * sin_a;
+    }
+  };
+}
@@ -0,0 +1,115 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <thread>
+#include <vector>
+
+// Prefix sums over arrays. Each V::step block is scanned in registers with
+// prefix_sum and the running total carried into the next block. The element
+// type is that of V, e.g. inclusive_scan<Vec4i64>(offsets, counts, n).
+
+namespace SVL {
+  namespace detail {
+    //! Scan n elements of in to out starting from total. Inclusive writes
+    //! in[0] + ... + in[i] to out[i], exclusive in[0] + ... + in[i - 1].
+    //! Returns the sum of all elements plus total
+    template <typename V, bool inclusive>
+    inline typename V::scalar_t scan(typename V::scalar_t* out,
+                                     const typename V::scalar_t* in, i64 n,
+                                     typename V::scalar_t total) {
+      using T = typename V::scalar_t;
+      T tmp[V::step + 1];
+      for (i64 i = 0; i < n; i += V::step) {
+        i64 m = SVL_MIN(i64(V::step), n - i);
+        V x = (m == V::step) ? V(in + i) : V().load_partial(in + i, m);
+        V sums = prefix_sum(x) + V(total);
+        // For exclusive shift the sums up one element, with the old total in front
+        if (!inclusive) {
+          tmp[0] = total;
+          sums.store(tmp + 1);
+        }
+        const V& result = inclusive ? sums : V(tmp);
+        if (m == V::step) result.store(out + i);
+        else result.store_partial(out + i, m);
+        total = sums[m - 1];
+      }
+      return total;
+    }
+
+    //! Run scan over n elements split between threads, in two passes: each
+    //! thread sums its chunk, then scans it starting from the sum of the
+    //! chunks before it
+    template <typename V, bool inclusive>
+    inline void parallel_scan(typename V::scalar_t* out,
+                              const typename V::scalar_t* in, i64 n,
+                              typename V::scalar_t init, i64 threads) {
+      using T = typename V::scalar_t;
+      threads = SVL_CLAMP(1, threads, SVL_MAX(1, n / (i64(V::step) * 1024)));
+      if (threads == 1) {
+        scan<V, inclusive>(out, in, n, init);
+        return;
+      }
+      // Chunks are whole numbers of vectors so only the last has a tail
+      i64 chunk = (n / threads + V::step - 1) / V::step * V::step;
+      std::vector<T> offsets(threads + 1, T(0));
+      std::vector<std::thread> workers;
+      auto run = [&](auto f) {
+        workers.clear();
+        for (i64 t = 0; t < threads; ++t) {
+          i64 begin = SVL_MIN(t * chunk, n), end = SVL_MIN(begin + chunk, n);
+          workers.emplace_back(f, t, begin, end);
+        }
+        for (std::thread& w : workers) w.join();
+      };
+      run([&](i64 t, i64 begin, i64 end) {
+        V acc = V::zeros();
+        i64 i = begin;
+        for (; i + V::step <= end; i += V::step) acc += V(in + i);
+        acc += V().load_partial(in + i, end - i);
+        offsets[t + 1] = prefix_sum(acc)[V::step - 1];
+      });
+      offsets[0] = init;
+      for (i64 t = 0; t < threads; ++t) offsets[t + 1] = T(offsets[t] + offsets[t + 1]);
+      run([&](i64 t, i64 begin, i64 end) {
+        scan<V, inclusive>(out + begin, in + begin, end - begin, offsets[t]);
+      });
+    }
+  }
+
+  //! Write init + in[0] + ... + in[i] to out[i] for the n elements of in.
+  //! out may be in. Returns init plus the sum of all elements
+  template <typename V = Vec8f>
+  inline typename V::scalar_t inclusive_scan(typename V::scalar_t* out,
+                                             const typename V::scalar_t* in, i64 n,
+                                             typename V::scalar_t init = 0) {
+    return detail::scan<V, true>(out, in, n, init);
+  }
+  //! Write init + in[0] + ... + in[i - 1] to out[i] for the n elements of in,
+  //! so out[0] is init. out may be in. Returns init plus the sum of all elements
+  template <typename V = Vec8f>
+  inline typename V::scalar_t exclusive_scan(typename V::scalar_t* out,
+                                             const typename V::scalar_t* in, i64 n,
+                                             typename V::scalar_t init = 0) {
+    return detail::scan<V, false>(out, in, n, init);
+  }
+
+  //! inclusive_scan split over up to threads threads, for arrays large enough
+  //! to be limited by memory bandwidth. Reads the input twice
+  template <typename V = Vec8f>
+  inline void parallel_inclusive_scan(typename V::scalar_t* out,
+                                      const typename V::scalar_t* in, i64 n,
+                                      typename V::scalar_t init = 0,
+                                      i64 threads = std::thread::hardware_concurrency()) {
+    detail::parallel_scan<V, true>(out, in, n, init, threads);
+  }
+  //! exclusive_scan split over up to threads threads, for arrays large enough
+  //! to be limited by memory bandwidth. Reads the input twice
+  template <typename V = Vec8f>
+  inline void parallel_exclusive_scan(typename V::scalar_t* out,
+                                      const typename V::scalar_t* in, i64 n,
+                                      typename V::scalar_t init = 0,
+                                      i64 threads = std::thread::hardware_concurrency()) {
+    detail::parallel_scan<V, false>(out, in, n, init, threads);
+  }
+}
@@ -0,0 +1,389 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+struct Vector16i16 {
+  // Comparisons give masks with all bits of a lane set rather than a bool type
+  VECTOR_NUMBER_SETUP(Vector16i16, 16, Vector16i16, i16, Vector8i16);
+
+#if SVL_SIMD_LEVEL < SVL_AVX2
+  using intrinsic_t = struct { half_t v0_7, v8_f; };
+#else
+  using intrinsic_t = __m256i;
+#endif
+  intrinsic_t data;
+
+  static self_t zeros() {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(half_t::zeros(), half_t::zeros());
+#else
+    return _mm256_setzero_si256();
+#endif
+  }
+
+  // Constructors
+  //! Default constructor
+  Vector16i16() = default;
+  //! Copy constructor
+  Vector16i16(const self_t&) = default;
+  //! Move constructor
+  Vector16i16(self_t&&) = default;
+  //! Copy assignment
+  self_t& operator=(const self_t&) = default;
+  //! Move assignment
+  self_t& operator=(self_t&&) = default;
+  //! Destructor
+  ~Vector16i16() = default;
+
+  //! Construct from an array
+  Vector16i16(const scalar_t* arr) { load(arr); }
+  //! Broadcast a value to all elements
+  Vector16i16(scalar_t v) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data = { half_t(v), half_t(v) };
+#else
+    data = _mm256_set1_epi16(v);
+#endif
+  }
+  //! Construct from two Vector8i16s
+  Vector16i16(const half_t& a, const half_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data = { a, b };
+#else
+    data = _mm256_set_m128i(b, a);
+#endif
+  }
+  //! Convert from intrinsic type
+  Vector16i16(const intrinsic_t& v) : data(v) { }
+  //! Covert to intrinsic type
+  operator intrinsic_t() const { return data; }
+  //! Assign from intrinsic type
+  self_t& operator=(const intrinsic_t& v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Assign from scalar type
+  self_t& operator=(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+
+  // Load/save data
+  //! Load values from an array
+  self_t& load(const scalar_t* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_7.load(arr);
+    data.v8_f.load(arr + half_step);
+#else
+    data = _mm256_loadu_si256((const __m256i*)arr);
+#endif
+    return *this;
+  }
+  //! Load n values from an array. Rest of data will be set to 0
+  self_t& load_partial(const scalar_t* arr, i64 n) {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_7.load_partial(arr, n);
+    data.v8_f.load_partial(arr + half_step, SVL_MAX(0, n - half_step));
+    return *this;
+#else
+    scalar_t tmp[step] = { };
+    memcpy(tmp, arr, n * sizeof(scalar_t));
+    return load(tmp);
+#endif
+  }
+  //! Load and broadcast a value to all elements
+  self_t& broadcast(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Store values in an array
+  void store(scalar_t* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    data.v0_7.store(arr);
+    data.v8_f.store(arr + half_step);
+#else
+    _mm256_storeu_si256((__m256i*)arr, data);
+#endif
+  }
+  //! Store n values in an array
+  void store_partial(scalar_t* arr, i64 n) const {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    if (n <= half_step) data.v0_7.store_partial(arr, n);
+    else {
+      data.v0_7.store(arr);
+      data.v8_f.store_partial(arr + half_step, n - half_step);
+    }
+#else
+    scalar_t tmp[step];
+    store(tmp);
+    memcpy(arr, tmp, n * sizeof(scalar_t));
+#endif
+  }
+
+  // Access single value
+  //! RO access to a single value
+  scalar_t access(i64 idx) const {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    return tmp[idx];
+  }
+  //! RO access to a single value
+  scalar_t operator[](i64 idx) const { return access(idx); }
+  //! Assign a single value
+  self_t& assign(scalar_t v, i64 idx) {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    tmp[idx] = v;
+    return load(tmp);
+  }
+
+  // Arithmetic operators, wrapping on overflow
+  //! Addition of two vectors
+  friend inline self_t operator+(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 + b.data.v0_7, a.data.v8_f + b.data.v8_f);
+#else
+    return _mm256_add_epi16(a, b);
+#endif
+  }
+  //! Inplace addition of two vectors
+  friend inline self_t& operator+=(self_t& a, const self_t& b) {
+    a = a + b;
+    return a;
+  }
+  //! Subtraction of two vectors
+  friend inline self_t operator-(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 - b.data.v0_7, a.data.v8_f - b.data.v8_f);
+#else
+    return _mm256_sub_epi16(a, b);
+#endif
+  }
+  //! Inplace subtraction of two vectors
+  friend inline self_t& operator-=(self_t& a, const self_t& b) {
+    a = a - b;
+    return a;
+  }
+  //! Negation of all elements
+  friend inline self_t operator-(const self_t& a) {
+    return zeros() - a;
+  }
+  //! Low 16 bits of the products of a and b
+  friend inline self_t operator*(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 * b.data.v0_7, a.data.v8_f * b.data.v8_f);
+#else
+    return _mm256_mullo_epi16(a, b);
+#endif
+  }
+  //! Inplace multiplication of two vectors
+  friend inline self_t& operator*=(self_t& a, const self_t& b) {
+    a = a * b;
+    return a;
+  }
+
+  // Comparison operators
+  //! Returns a mask of all elements where a == b
+  friend inline self_t operator==(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 == b.data.v0_7, a.data.v8_f == b.data.v8_f);
+#else
+    return _mm256_cmpeq_epi16(a, b);
+#endif
+  }
+  //! Returns a mask of all elements where a != b
+  friend inline self_t operator!=(const self_t& a, const self_t& b) {
+    return ~(a == b);
+  }
+  //! Returns a mask of all elements where a > b
+  friend inline self_t operator>(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 > b.data.v0_7, a.data.v8_f > b.data.v8_f);
+#else
+    return _mm256_cmpgt_epi16(a, b);
+#endif
+  }
+  //! Returns a mask of all elements where a < b
+  friend inline self_t operator<(const self_t& a, const self_t& b) {
+    return b > a;
+  }
+  //! Returns a mask of all elements where a >= b
+  friend inline self_t operator>=(const self_t& a, const self_t& b) {
+    return ~(b > a);
+  }
+  //! Returns a mask of all elements where a <= b
+  friend inline self_t operator<=(const self_t& a, const self_t& b) {
+    return ~(a > b);
+  }
+
+  // Logical operators
+  //! Bitwise AND of two vectors
+  friend inline self_t operator&(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 & b.data.v0_7, a.data.v8_f & b.data.v8_f);
+#else
+    return _mm256_and_si256(a, b);
+#endif
+  }
+  //! Bitwise OR of two vectors
+  friend inline self_t operator|(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 | b.data.v0_7, a.data.v8_f | b.data.v8_f);
+#else
+    return _mm256_or_si256(a, b);
+#endif
+  }
+  //! Bitwise XOR of two vectors
+  friend inline self_t operator^(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 ^ b.data.v0_7, a.data.v8_f ^ b.data.v8_f);
+#else
+    return _mm256_xor_si256(a, b);
+#endif
+  }
+  //! Bitwise NOT of a vector
+  friend inline self_t operator~(const self_t& a) {
+    return a ^ self_t(scalar_t(-1));
+  }
+  //! Bitwise ANDNOT of two vectors, ~a & b
+  friend inline self_t and_not(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(and_not(a.data.v0_7, b.data.v0_7),
+                  and_not(a.data.v8_f, b.data.v8_f));
+#else
+    return _mm256_andnot_si256(a, b);
+#endif
+  }
+
+  // Shifts
+  //! Shift all elements of a left by n bits
+  friend inline self_t operator<<(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 << n, a.data.v8_f << n);
+#else
+    return _mm256_sll_epi16(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in copies of the sign bit
+  friend inline self_t operator>>(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(a.data.v0_7 >> n, a.data.v8_f >> n);
+#else
+    return _mm256_sra_epi16(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in zeros
+  friend inline self_t shift_right_logical(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(shift_right_logical(a.data.v0_7, n),
+                  shift_right_logical(a.data.v8_f, n));
+#else
+    return _mm256_srl_epi16(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+
+  // General functions
+  //! Blend two vectors, taking elements from a where mask is set
+  friend inline self_t blend(const self_t& a, const self_t& b, const self_t& mask) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(blend(a.data.v0_7, b.data.v0_7, mask.data.v0_7),
+                  blend(a.data.v8_f, b.data.v8_f, mask.data.v8_f));
+#else
+    return _mm256_blendv_epi8(b, a, mask);
+#endif
+  }
+  //! Elementwise maximum of a and b
+  friend inline self_t max(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(max(a.data.v0_7, b.data.v0_7),
+                  max(a.data.v8_f, b.data.v8_f));
+#else
+    return _mm256_max_epi16(a, b);
+#endif
+  }
+  //! Elementwise minimum of a and b
+  friend inline self_t min(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(min(a.data.v0_7, b.data.v0_7),
+                  min(a.data.v8_f, b.data.v8_f));
+#else
+    return _mm256_min_epi16(a, b);
+#endif
+  }
+  //! Absolute value of all elements. -32768 stays -32768
+  friend inline self_t abs(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(abs(a.data.v0_7), abs(a.data.v8_f));
+#else
+    return _mm256_abs_epi16(a);
+#endif
+  }
+  //! Addition of two vectors, saturating at -32768 and 32767
+  friend inline self_t add_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(add_saturated(a.data.v0_7, b.data.v0_7),
+                  add_saturated(a.data.v8_f, b.data.v8_f));
+#else
+    return _mm256_adds_epi16(a, b);
+#endif
+  }
+  //! Subtraction of two vectors, saturating at -32768 and 32767
+  friend inline self_t sub_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(sub_saturated(a.data.v0_7, b.data.v0_7),
+                  sub_saturated(a.data.v8_f, b.data.v8_f));
+#else
+    return _mm256_subs_epi16(a, b);
+#endif
+  }
+  //! Average of a and b rounded up, (a + b + 1) >> 1 without overflow
+  friend inline self_t avg(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(avg(a.data.v0_7, b.data.v0_7),
+                  avg(a.data.v8_f, b.data.v8_f));
+#else
+    // Offset to unsigned, use the unsigned average and offset back
+    const __m256i bias = _mm256_set1_epi16(i16(0x8000));
+    return _mm256_xor_si256(_mm256_avg_epu16(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias)),
+                         bias);
+#endif
+  }
+  //! High 16 bits of the 32 bit products of a and b
+  friend inline self_t mulhi(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    return self_t(mulhi(a.data.v0_7, b.data.v0_7),
+                  mulhi(a.data.v8_f, b.data.v8_f));
+#else
+    return _mm256_mulhi_epi16(a, b);
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i], wrapping on
+  //! overflow
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX2
+    half_t lo = prefix_sum(a.data.v0_7);
+    return self_t(lo, prefix_sum(a.data.v8_f) + half_t(lo[half_step - 1]));
+#else
+    // Scan each 128 bit lane, then add the total of the low lane to the high one
+    __m256i x = _mm256_add_epi16(a, _mm256_slli_si256(a, 2));
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 8));
+    __m256i t = _mm256_shufflehi_epi16(x, 0xff);
+    t = _mm256_unpackhi_epi64(t, t);
+    return _mm256_add_epi16(x, _mm256_permute2x128_si256(t, t, 0x08));
+#endif
+  }
+};
+
+#ifdef DEBUG
+static inline std::ostream& operator<<(std::ostream& os, const Vector16i16& v) {
+  os << "<";
+  SVL_FOR_RANGE(v.step) os << v[i] << ((i < (v.step - 1)) ? ", " : "");
+  os << ">";
+  return os;
+}
+#endif
@@ -0,0 +1,393 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+struct Vector32i16 {
+  // Comparisons give masks with all bits of a lane set rather than a bool type
+  VECTOR_NUMBER_SETUP(Vector32i16, 32, Vector32i16, i16, Vector16i16);
+
+#if SVL_SIMD_LEVEL < SVL_AVX512
+  using intrinsic_t = struct { half_t v0_f, v10_1f; };
+#else
+  using intrinsic_t = __m512i;
+#endif
+  intrinsic_t data;
+
+  static self_t zeros() {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(half_t::zeros(), half_t::zeros());
+#else
+    return _mm512_setzero_si512();
+#endif
+  }
+
+  // Constructors
+  //! Default constructor
+  Vector32i16() = default;
+  //! Copy constructor
+  Vector32i16(const self_t&) = default;
+  //! Move constructor
+  Vector32i16(self_t&&) = default;
+  //! Copy assignment
+  self_t& operator=(const self_t&) = default;
+  //! Move assignment
+  self_t& operator=(self_t&&) = default;
+  //! Destructor
+  ~Vector32i16() = default;
+
+  //! Construct from an array
+  Vector32i16(const scalar_t* arr) { load(arr); }
+  //! Broadcast a value to all elements
+  Vector32i16(scalar_t v) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data = { half_t(v), half_t(v) };
+#else
+    data = _mm512_set1_epi16(v);
+#endif
+  }
+  //! Construct from two Vector16i16s
+  Vector32i16(const half_t& a, const half_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data = { a, b };
+#else
+    data = _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+#endif
+  }
+  //! Convert from intrinsic type
+  Vector32i16(const intrinsic_t& v) : data(v) { }
+  //! Covert to intrinsic type
+  operator intrinsic_t() const { return data; }
+  //! Assign from intrinsic type
+  self_t& operator=(const intrinsic_t& v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Assign from scalar type
+  self_t& operator=(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+
+  // Load/save data
+  //! Load values from an array
+  self_t& load(const scalar_t* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_f.load(arr);
+    data.v10_1f.load(arr + half_step);
+#else
+    data = _mm512_loadu_si512((const __m512i*)arr);
+#endif
+    return *this;
+  }
+  //! Load n values from an array. Rest of data will be set to 0
+  self_t& load_partial(const scalar_t* arr, i64 n) {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_f.load_partial(arr, n);
+    data.v10_1f.load_partial(arr + half_step, SVL_MAX(0, n - half_step));
+    return *this;
+#else
+    scalar_t tmp[step] = { };
+    memcpy(tmp, arr, n * sizeof(scalar_t));
+    return load(tmp);
+#endif
+  }
+  //! Load and broadcast a value to all elements
+  self_t& broadcast(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Store values in an array
+  void store(scalar_t* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_f.store(arr);
+    data.v10_1f.store(arr + half_step);
+#else
+    _mm512_storeu_si512((__m512i*)arr, data);
+#endif
+  }
+  //! Store n values in an array
+  void store_partial(scalar_t* arr, i64 n) const {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    if (n <= half_step) data.v0_f.store_partial(arr, n);
+    else {
+      data.v0_f.store(arr);
+      data.v10_1f.store_partial(arr + half_step, n - half_step);
+    }
+#else
+    scalar_t tmp[step];
+    store(tmp);
+    memcpy(arr, tmp, n * sizeof(scalar_t));
+#endif
+  }
+
+  // Access single value
+  //! RO access to a single value
+  scalar_t access(i64 idx) const {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    return tmp[idx];
+  }
+  //! RO access to a single value
+  scalar_t operator[](i64 idx) const { return access(idx); }
+  //! Assign a single value
+  self_t& assign(scalar_t v, i64 idx) {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    tmp[idx] = v;
+    return load(tmp);
+  }
+
+  // Arithmetic operators, wrapping on overflow
+  //! Addition of two vectors
+  friend inline self_t operator+(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f + b.data.v0_f, a.data.v10_1f + b.data.v10_1f);
+#else
+    return _mm512_add_epi16(a, b);
+#endif
+  }
+  //! Inplace addition of two vectors
+  friend inline self_t& operator+=(self_t& a, const self_t& b) {
+    a = a + b;
+    return a;
+  }
+  //! Subtraction of two vectors
+  friend inline self_t operator-(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f - b.data.v0_f, a.data.v10_1f - b.data.v10_1f);
+#else
+    return _mm512_sub_epi16(a, b);
+#endif
+  }
+  //! Inplace subtraction of two vectors
+  friend inline self_t& operator-=(self_t& a, const self_t& b) {
+    a = a - b;
+    return a;
+  }
+  //! Negation of all elements
+  friend inline self_t operator-(const self_t& a) {
+    return zeros() - a;
+  }
+  //! Low 16 bits of the products of a and b
+  friend inline self_t operator*(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f * b.data.v0_f, a.data.v10_1f * b.data.v10_1f);
+#else
+    return _mm512_mullo_epi16(a, b);
+#endif
+  }
+  //! Inplace multiplication of two vectors
+  friend inline self_t& operator*=(self_t& a, const self_t& b) {
+    a = a * b;
+    return a;
+  }
+
+  // Comparison operators
+  //! Returns a mask of all elements where a == b
+  friend inline self_t operator==(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f == b.data.v0_f, a.data.v10_1f == b.data.v10_1f);
+#else
+    return _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a, b));
+#endif
+  }
+  //! Returns a mask of all elements where a != b
+  friend inline self_t operator!=(const self_t& a, const self_t& b) {
+    return ~(a == b);
+  }
+  //! Returns a mask of all elements where a > b
+  friend inline self_t operator>(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f > b.data.v0_f, a.data.v10_1f > b.data.v10_1f);
+#else
+    return _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a, b));
+#endif
+  }
+  //! Returns a mask of all elements where a < b
+  friend inline self_t operator<(const self_t& a, const self_t& b) {
+    return b > a;
+  }
+  //! Returns a mask of all elements where a >= b
+  friend inline self_t operator>=(const self_t& a, const self_t& b) {
+    return ~(b > a);
+  }
+  //! Returns a mask of all elements where a <= b
+  friend inline self_t operator<=(const self_t& a, const self_t& b) {
+    return ~(a > b);
+  }
+
+  // Logical operators
+  //! Bitwise AND of two vectors
+  friend inline self_t operator&(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f & b.data.v0_f, a.data.v10_1f & b.data.v10_1f);
+#else
+    return _mm512_and_si512(a, b);
+#endif
+  }
+  //! Bitwise OR of two vectors
+  friend inline self_t operator|(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f | b.data.v0_f, a.data.v10_1f | b.data.v10_1f);
+#else
+    return _mm512_or_si512(a, b);
+#endif
+  }
+  //! Bitwise XOR of two vectors
+  friend inline self_t operator^(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f ^ b.data.v0_f, a.data.v10_1f ^ b.data.v10_1f);
+#else
+    return _mm512_xor_si512(a, b);
+#endif
+  }
+  //! Bitwise NOT of a vector
+  friend inline self_t operator~(const self_t& a) {
+    return a ^ self_t(scalar_t(-1));
+  }
+  //! Bitwise ANDNOT of two vectors, ~a & b
+  friend inline self_t and_not(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(and_not(a.data.v0_f, b.data.v0_f),
+                  and_not(a.data.v10_1f, b.data.v10_1f));
+#else
+    return _mm512_andnot_si512(a, b);
+#endif
+  }
+
+  // Shifts
+  //! Shift all elements of a left by n bits
+  friend inline self_t operator<<(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f << n, a.data.v10_1f << n);
+#else
+    return _mm512_sll_epi16(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in copies of the sign bit
+  friend inline self_t operator>>(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_f >> n, a.data.v10_1f >> n);
+#else
+    return _mm512_sra_epi16(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in zeros
+  friend inline self_t shift_right_logical(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(shift_right_logical(a.data.v0_f, n),
+                  shift_right_logical(a.data.v10_1f, n));
+#else
+    return _mm512_srl_epi16(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+
+  // General functions
+  //! Blend two vectors, taking elements from a where mask is set
+  friend inline self_t blend(const self_t& a, const self_t& b, const self_t& mask) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(blend(a.data.v0_f, b.data.v0_f, mask.data.v0_f),
+                  blend(a.data.v10_1f, b.data.v10_1f, mask.data.v10_1f));
+#else
+    return _mm512_mask_blend_epi16(_mm512_movepi16_mask(mask), b, a);
+#endif
+  }
+  //! Elementwise maximum of a and b
+  friend inline self_t max(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(max(a.data.v0_f, b.data.v0_f),
+                  max(a.data.v10_1f, b.data.v10_1f));
+#else
+    return _mm512_max_epi16(a, b);
+#endif
+  }
+  //! Elementwise minimum of a and b
+  friend inline self_t min(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(min(a.data.v0_f, b.data.v0_f),
+                  min(a.data.v10_1f, b.data.v10_1f));
+#else
+    return _mm512_min_epi16(a, b);
+#endif
+  }
+  //! Absolute value of all elements. -32768 stays -32768
+  friend inline self_t abs(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(abs(a.data.v0_f), abs(a.data.v10_1f));
+#else
+    return _mm512_abs_epi16(a);
+#endif
+  }
+  //! Addition of two vectors, saturating at -32768 and 32767
+  friend inline self_t add_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(add_saturated(a.data.v0_f, b.data.v0_f),
+                  add_saturated(a.data.v10_1f, b.data.v10_1f));
+#else
+    return _mm512_adds_epi16(a, b);
+#endif
+  }
+  //! Subtraction of two vectors, saturating at -32768 and 32767
+  friend inline self_t sub_saturated(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(sub_saturated(a.data.v0_f, b.data.v0_f),
+                  sub_saturated(a.data.v10_1f, b.data.v10_1f));
+#else
+    return _mm512_subs_epi16(a, b);
+#endif
+  }
+  //! Average of a and b rounded up, (a + b + 1) >> 1 without overflow
+  friend inline self_t avg(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(avg(a.data.v0_f, b.data.v0_f),
+                  avg(a.data.v10_1f, b.data.v10_1f));
+#else
+    // Offset to unsigned, use the unsigned average and offset back
+    const __m512i bias = _mm512_set1_epi16(i16(0x8000));
+    return _mm512_xor_si512(_mm512_avg_epu16(_mm512_xor_si512(a, bias), _mm512_xor_si512(b, bias)),
+                         bias);
+#endif
+  }
+  //! High 16 bits of the 32 bit products of a and b
+  friend inline self_t mulhi(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(mulhi(a.data.v0_f, b.data.v0_f),
+                  mulhi(a.data.v10_1f, b.data.v10_1f));
+#else
+    return _mm512_mulhi_epi16(a, b);
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i], wrapping on
+  //! overflow
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t lo = prefix_sum(a.data.v0_f);
+    return self_t(lo, prefix_sum(a.data.v10_1f) + half_t(lo[half_step - 1]));
+#else
+    // Scan each 128 bit lane, then scan the lane totals and add those of the
+    // lanes below to each lane
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i x = _mm512_add_epi16(a, _mm512_bslli_epi128(a, 2));
+    x = _mm512_add_epi16(x, _mm512_bslli_epi128(x, 4));
+    x = _mm512_add_epi16(x, _mm512_bslli_epi128(x, 8));
+    __m512i t = _mm512_shufflehi_epi16(x, 0xff);
+    t = _mm512_unpackhi_epi64(t, t);
+    t = _mm512_add_epi16(t, _mm512_alignr_epi32(t, zero, 12));
+    t = _mm512_add_epi16(t, _mm512_alignr_epi32(t, zero, 8));
+    return _mm512_add_epi16(x, _mm512_alignr_epi32(t, zero, 12));
+#endif
+  }
+};
+
+#ifdef DEBUG
+static inline std::ostream& operator<<(std::ostream& os, const Vector32i16& v) {
+  os << "<";
+  SVL_FOR_RANGE(v.step) os << v[i] << ((i < (v.step - 1)) ? ", " : "");
+  os << ">";
+  return os;
+}
+#endif
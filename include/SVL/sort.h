@@ -0,0 +1,168 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+#include <vector>
+
+// Sorting arrays of floats. Blocks of V::step keys are sorted in registers
+// with the bitonic networks of the Vector*f types, then runs are merged
+// pairwise a vector at a time with merge_sorted until one run remains. Runs
+// are first merged within cache sized chunks before the passes over the
+// whole array. Needs a scratch buffer the size of the input. NaNs are not
+// supported.
+
+namespace SVL {
+  namespace detail {
+    //! Keys and optional values being sorted. The values only ever move, so
+    //! they are copied in and out of the float vectors by memcpy
+    template <typename V, bool kv>
+    struct sort_arrays {
+      static_assert(sizeof(V) == V::step * sizeof(u32), "values fill a vector");
+      flt* keys;
+      u32* values;
+
+      sort_arrays offset(i64 i) const { return { keys + i, kv ? values + i : nullptr }; }
+      void load(i64 i, V& k, V& v) const {
+        k.load(keys + i);
+        if constexpr (kv) memcpy(&v, values + i, sizeof(V));
+      }
+      void store(i64 i, const V& k, const V& v) const {
+        k.store(keys + i);
+        if constexpr (kv) memcpy(values + i, &v, sizeof(V));
+      }
+      void copy(i64 i, const sort_arrays& from, i64 n) const {
+        memcpy(keys + i, from.keys + i, n * sizeof(flt));
+        if constexpr (kv) memcpy(values + i, from.values + i, n * sizeof(u32));
+      }
+    };
+
+    template <typename V, bool kv>
+    inline void merge_pair(V& ka, V& va, V& kb, V& vb) {
+      if constexpr (kv) merge_sorted(ka, va, kb, vb);
+      else merge_sorted(ka, kb);
+    }
+
+    //! Merge the sorted runs a and b, of na and nb keys (multiples of
+    //! V::step), into out
+    template <typename V, bool kv>
+    inline void merge_runs(const sort_arrays<V, kv>& a, i64 na,
+                           const sort_arrays<V, kv>& b, i64 nb,
+                           const sort_arrays<V, kv>& out) {
+      if (nb == 0) {
+        out.copy(0, a, na);
+        return;
+      }
+      // lo/hi hold the merged output to come, lo is written out after each
+      // merge and refilled from whichever run has the smaller next key
+      V klo, vlo, khi, vhi;
+      a.load(0, klo, vlo);
+      b.load(0, khi, vhi);
+      merge_pair<V, kv>(klo, vlo, khi, vhi);
+      i64 ia = V::step, ib = V::step, io = 0;
+      for (;;) {
+        out.store(io, klo, vlo);
+        io += V::step;
+        if (ia < na && (ib == nb || a.keys[ia] <= b.keys[ib])) {
+          a.load(ia, klo, vlo);
+          ia += V::step;
+        } else if (ib < nb) {
+          b.load(ib, klo, vlo);
+          ib += V::step;
+        } else break;
+        merge_pair<V, kv>(klo, vlo, khi, vhi);
+      }
+      out.store(io, khi, vhi);
+    }
+
+    //! Merge runs of width, doubling while width < end, over the n keys of src
+    //! (a multiple of V::step) using dst as scratch. Returns true if the
+    //! result ended up in dst
+    template <typename V, bool kv>
+    inline bool merge_passes(sort_arrays<V, kv> src, sort_arrays<V, kv> dst,
+                             i64 n, i64 width, i64 end) {
+      bool swapped = false;
+      for (; width < end; width *= 2) {
+        for (i64 i = 0; i < n; i += 2 * width) {
+          i64 na = SVL_MIN(width, n - i), nb = SVL_MIN(width, n - i - na);
+          merge_runs<V, kv>(src.offset(i), na, src.offset(i + na), nb, dst.offset(i));
+        }
+        std::swap(src, dst);
+        swapped = !swapped;
+      }
+      return swapped;
+    }
+
+    //! Insertion sort of the n keys (and values) starting at data
+    template <typename V, bool kv>
+    inline void insertion_sort(const sort_arrays<V, kv>& data, i64 n) {
+      for (i64 i = 1; i < n; ++i)
+        for (i64 j = i; j > 0 && data.keys[j] < data.keys[j - 1]; --j) {
+          std::swap(data.keys[j], data.keys[j - 1]);
+          if constexpr (kv) std::swap(data.values[j], data.values[j - 1]);
+        }
+    }
+
+    template <typename V, bool kv>
+    inline void sort(sort_arrays<V, kv> data, i64 n) {
+      // Keys per chunk that are fully merged before the whole array passes
+      const i64 chunk = 8192;
+      i64 full = n - n % V::step;
+      if (full > 0) {
+        V k, v;
+        for (i64 i = 0; i < full; i += V::step) {
+          data.load(i, k, v);
+          if constexpr (kv) sort(k, v);
+          else k = sort(k);
+          data.store(i, k, v);
+        }
+        // Small sorts use the stack rather than allocating
+        const i64 small = 256;
+        flt small_keys[small];
+        u32 small_values[kv ? small : 1];
+        std::vector<flt> scratch_keys(full > small ? full : 0);
+        std::vector<u32> scratch_values(kv && full > small ? full : 0);
+        sort_arrays<V, kv> scratch{ full > small ? scratch_keys.data() : small_keys,
+                                    full > small ? scratch_values.data() : small_values };
+        // Every chunk makes the same number of passes, so they all finish in
+        // the same buffer
+        bool in_scratch = false;
+        for (i64 i = 0; i < full; i += chunk)
+          in_scratch = merge_passes<V, kv>(data.offset(i), scratch.offset(i),
+                                           SVL_MIN(chunk, full - i), V::step, chunk);
+        if (merge_passes<V, kv>(in_scratch ? scratch : data, in_scratch ? data : scratch,
+                                full, chunk, full))
+          in_scratch = !in_scratch;
+        if (in_scratch) data.copy(0, scratch, full);
+      }
+      // Sort the last keys that do not fill a vector and merge them in from
+      // the back
+      i64 tail = n - full;
+      if (tail > 0) {
+        flt tk[V::step];
+        u32 tv[V::step];
+        memcpy(tk, data.keys + full, tail * sizeof(flt));
+        if constexpr (kv) memcpy(tv, data.values + full, tail * sizeof(u32));
+        insertion_sort(sort_arrays<V, kv>{ tk, tv }, tail);
+        for (i64 i = full - 1, j = tail - 1, o = n - 1; j >= 0; --o) {
+          bool from_data = i >= 0 && data.keys[i] > tk[j];
+          i64 src = from_data ? i-- : j--;
+          data.keys[o] = from_data ? data.keys[src] : tk[src];
+          if constexpr (kv) data.values[o] = from_data ? data.values[src] : tv[src];
+        }
+      }
+    }
+  }
+
+  //! Sort the n keys into ascending order. NaNs are not supported
+  template <typename V = Vec8f>
+  inline void sort(flt* keys, i64 n) {
+    detail::sort(detail::sort_arrays<V, false>{ keys, nullptr }, n);
+  }
+  //! Sort the n keys into ascending order, moving the values with them, e.g.
+  //! with values 0 to n - 1 to find the sorting permutation. NaNs are not
+  //! supported
+  template <typename V = Vec8f>
+  inline void sort(flt* keys, u32* values, i64 n) {
+    detail::sort(detail::sort_arrays<V, true>{ keys, values }, n);
+  }
+}
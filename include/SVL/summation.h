@@ -0,0 +1,127 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+// Accurate sums over arrays of floats. The compensated kernels keep the
+// exact rounding error of every addition (TwoSum) and product (TwoProduct)
+// in a second accumulator per lane, so the result is about as accurate as
+// summing in double precision and rounding once. pairwise_sum is cheaper and
+// only keeps the error growth down to the log of n.
+
+namespace SVL {
+  namespace detail {
+    //! Rounded s + x, adding the exact rounding error to err
+    template <typename V>
+    inline V two_sum(const V& s, const V& x, V& err) {
+      V t = s + x, z = t - s;
+      err += (s - (t - z)) + (x - z);
+      return t;
+    }
+    //! Fold err into s, leaving the exact remainder in err. Keeps err small
+    //! enough that adding to it stays close to exact
+    template <typename V>
+    inline void renormalise(V& s, V& err) {
+      V r = V::zeros();
+      s = two_sum(s, err, r);
+      err = r;
+    }
+
+    //! Compensated total of four pairs of sums and errors
+    template <typename V>
+    inline flt merge_compensated(V s0, V s1, V s2, V s3, const V& e0, const V& e1, const V& e2,
+                                 const V& e3) {
+      V err = (e0 + e1) + (e2 + e3);
+      s0 = two_sum(s0, s1, err);
+      s2 = two_sum(s2, s3, err);
+      s0 = two_sum(s0, s2, err);
+      flt sums[V::step], errs[V::step];
+      s0.store(sums);
+      err.store(errs);
+      flt sum = 0.f, e = 0.f;
+      for (i64 l = 0; l < V::step; ++l) {
+        sum = two_sum(sum, sums[l], e);
+        e += errs[l];
+      }
+      // Infinities and NaNs leave NaN errors
+      return std::isfinite(sum) ? sum + e : sum;
+    }
+
+    //! Sum of the n elements from data, splitting in halves down to blocks
+    //! summed in registers
+    template <typename V>
+    inline flt pairwise_sum(i64 n, const flt* data) {
+      const i64 block = 32 * V::step;
+      if (n <= block)
+        return horizontal_add(accumulate<V>(n, [&](const V& acc, i64 i, i64 m) {
+          return acc + load_elements<V, false>(data + i, 1, m);
+        }, add()));
+      // Split on a whole block so the loads stay in step
+      const i64 half = (n / 2 + block - 1) / block * block;
+      return pairwise_sum<V>(half, data) + pairwise_sum<V>(n - half, data + half);
+    }
+  }
+
+  //! Sum of the n elements of x, with the exact error of every addition
+  //! summed alongside in each lane. Like Neumaier's (and unlike Kahan's)
+  //! summation this holds up when the terms are larger than the running sum.
+  //! The result is about as accurate as a sum in double precision, rounded
+  //! once. Infinities and NaNs give the plain sum
+  template <typename V = Vec8f>
+  inline flt compensated_sum(i64 n, const flt* x) {
+    V s0 = V::zeros(), s1 = s0, s2 = s0, s3 = s0, e0 = s0, e1 = s0, e2 = s0, e3 = s0;
+    i64 i = 0;
+    for (; i + 4 * V::step <= n; i += 4 * V::step) {
+      s0 = detail::two_sum(s0, V(x + i), e0);
+      s1 = detail::two_sum(s1, V(x + i + V::step), e1);
+      s2 = detail::two_sum(s2, V(x + i + 2 * V::step), e2);
+      s3 = detail::two_sum(s3, V(x + i + 3 * V::step), e3);
+      // A large err would lose its own low bits, so fold it in now and then
+      if ((i / (4 * V::step)) % 256 == 255) {
+        detail::renormalise(s0, e0);
+        detail::renormalise(s1, e1);
+        detail::renormalise(s2, e2);
+        detail::renormalise(s3, e3);
+      }
+    }
+    for (; i < n; i += V::step)
+      s0 = detail::two_sum(s0, detail::load_elements<V, false>(x + i, 1, n - i), e0);
+    return detail::merge_compensated(s0, s1, s2, s3, e0, e1, e2, e3);
+  }
+
+  //! Sum of x[i] * y[i] over the n elements, with the errors of the products
+  //! and the additions summed alongside (Ogita, Rump and Oishi's Dot2). As
+  //! accurate as a dot product in double precision, rounded once
+  template <typename V = Vec8f>
+  inline flt compensated_dot(i64 n, const flt* x, const flt* y) {
+    V s0 = V::zeros(), s1 = s0, s2 = s0, s3 = s0, e0 = s0, e1 = s0, e2 = s0, e3 = s0;
+    auto step = [](V& s, V& e, const V& a, const V& b) {
+      V p = a * b;
+      e += detail::two_product_error(a, b, p);
+      s = detail::two_sum(s, p, e);
+    };
+    i64 i = 0;
+    for (; i + 4 * V::step <= n; i += 4 * V::step) {
+      step(s0, e0, V(x + i), V(y + i));
+      step(s1, e1, V(x + i + V::step), V(y + i + V::step));
+      step(s2, e2, V(x + i + 2 * V::step), V(y + i + 2 * V::step));
+      step(s3, e3, V(x + i + 3 * V::step), V(y + i + 3 * V::step));
+      if ((i / (4 * V::step)) % 256 == 255) {
+        detail::renormalise(s0, e0);
+        detail::renormalise(s1, e1);
+        detail::renormalise(s2, e2);
+        detail::renormalise(s3, e3);
+      }
+    }
+    for (; i < n; i += V::step)
+      step(s0, e0, detail::load_elements<V, false>(x + i, 1, n - i),
+           detail::load_elements<V, false>(y + i, 1, n - i));
+    return detail::merge_compensated(s0, s1, s2, s3, e0, e1, e2, e3);
+  }
+
+  //! Sum of the n elements of x by recursive halving, so the error grows
+  //! with log2(n) rather than n. Almost as fast as a plain sum
+  template <typename V = Vec8f>
+  inline flt pairwise_sum(i64 n, const flt* x) {
+    return detail::pairwise_sum<V>(n, x);
+  }
+}
@@ -0,0 +1,345 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+struct Vector2u64 {
+  // Comparisons give masks with all 64 bits of a lane set
+  VECTOR_NUMBER_SETUP(Vector2u64, 2, Vector2u64, u64, std::nullptr_t);
+
+#if SVL_SIMD_LEVEL < SVL_SSE
+  using intrinsic_t = struct { scalar_t v[2]; };
+#else
+  // Intrinsic type will always be _m128i with simd
+  using intrinsic_t = __m128i;
+#endif
+  intrinsic_t data;
+
+  static self_t zeros() {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    memset(&r.data, 0, sizeof(r.data));
+    return r;
+#else
+    return _mm_setzero_si128();
+#endif
+  }
+
+  // Constructors
+  //! Default constructor
+  Vector2u64() = default;
+  //! Copy constructor
+  Vector2u64(const self_t&) = default;
+  //! Move constructor
+  Vector2u64(self_t&&) = default;
+  //! Copy assignment
+  self_t& operator=(const self_t&) = default;
+  //! Move assignment
+  self_t& operator=(self_t&&) = default;
+  //! Destructor
+  ~Vector2u64() = default;
+
+  //! Construct from an array
+  Vector2u64(const scalar_t* arr) { load(arr); }
+  //! Broadcast a value to all elements
+  Vector2u64(scalar_t v) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    SVL_FOR_RANGE(step) data.v[i] = v;
+#else
+    data = _mm_set1_epi64x(i64(v));
+#endif
+  }
+  //! Construct from the given values
+  Vector2u64(scalar_t v0, scalar_t v1) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    data = {{ v0, v1 }};
+#else
+    data = _mm_set_epi64x(i64(v1), i64(v0));
+#endif
+  }
+  //! Convert from intrinsic type
+  Vector2u64(const intrinsic_t& v) : data(v) { }
+  //! Covert to intrinsic type
+  operator intrinsic_t() const { return data; }
+  //! Assign from intrinsic type
+  self_t& operator=(const intrinsic_t& v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Assign from scalar type
+  self_t& operator=(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+
+  // Load/save data
+  //! Load values from an array
+  self_t& load(const scalar_t* arr) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    memcpy(data.v, arr, sizeof(data.v));
+#else
+    data = _mm_loadu_si128((const __m128i*)arr);
+#endif
+    return *this;
+  }
+  //! Load n values from an array. Rest of data will be set to 0
+  self_t& load_partial(const scalar_t* arr, i64 n) {
+    n = SVL_CLAMP(0, n, step);
+    scalar_t tmp[step] = { };
+    memcpy(tmp, arr, n * sizeof(scalar_t));
+    return load(tmp);
+  }
+  //! Load and broadcast a value to all elements
+  self_t& broadcast(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Store values in an array
+  void store(scalar_t* arr) const {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    memcpy(arr, data.v, sizeof(data.v));
+#else
+    _mm_storeu_si128((__m128i*)arr, data);
+#endif
+  }
+  //! Store n values in an array
+  void store_partial(scalar_t* arr, i64 n) const {
+    n = SVL_CLAMP(0, n, step);
+    scalar_t tmp[step];
+    store(tmp);
+    memcpy(arr, tmp, n * sizeof(scalar_t));
+  }
+
+  // Access single value
+  //! RO access to a single value
+  scalar_t access(i64 idx) const {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    return tmp[idx];
+  }
+  //! RO access to a single value
+  scalar_t operator[](i64 idx) const { return access(idx); }
+  //! Assign a single value
+  self_t& assign(scalar_t v, i64 idx) {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    tmp[idx] = v;
+    return load(tmp);
+  }
+
+  // Arithmetic operators, wrapping on overflow
+  //! Addition of two vectors
+  friend inline self_t operator+(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(u64(a.data.v[i]) + u64(b.data.v[i]));
+    return r;
+#else
+    return _mm_add_epi64(a, b);
+#endif
+  }
+  //! Inplace addition of two vectors
+  friend inline self_t& operator+=(self_t& a, const self_t& b) {
+    a = a + b;
+    return a;
+  }
+  //! Subtraction of two vectors
+  friend inline self_t operator-(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(u64(a.data.v[i]) - u64(b.data.v[i]));
+    return r;
+#else
+    return _mm_sub_epi64(a, b);
+#endif
+  }
+  //! Inplace subtraction of two vectors
+  friend inline self_t& operator-=(self_t& a, const self_t& b) {
+    a = a - b;
+    return a;
+  }
+  //! Low 64 bits of the products of a and b
+  friend inline self_t operator*(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = scalar_t(u64(a.data.v[i]) * u64(b.data.v[i]));
+    return r;
+#elif SVL_SIMD_LEVEL < SVL_AVX512
+    // Emulated from 32 x 32 -> 64 bit products: lo * lo + ((hi * lo + lo * hi) << 32)
+    __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                   _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+    return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+#else
+    return _mm_mullo_epi64(a, b);
+#endif
+  }
+  //! Inplace multiplication of two vectors
+  friend inline self_t& operator*=(self_t& a, const self_t& b) {
+    a = a * b;
+    return a;
+  }
+
+  // Comparison operators
+  //! Returns a mask of all elements where a == b
+  friend inline self_t operator==(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] == b.data.v[i] ? scalar_t(-1) : 0;
+    return r;
+#else
+    return _mm_cmpeq_epi64(a, b);
+#endif
+  }
+  //! Returns a mask of all elements where a != b
+  friend inline self_t operator!=(const self_t& a, const self_t& b) {
+    return ~(a == b);
+  }
+  //! Returns a mask of all elements where a > b
+  friend inline self_t operator>(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] > b.data.v[i] ? scalar_t(-1) : 0;
+    return r;
+#else
+    // Flip the sign bits so the signed compare orders unsigned values
+    const __m128i bias = _mm_set1_epi64x(INT64_MIN);
+    return _mm_cmpgt_epi64(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+#endif
+  }
+  //! Returns a mask of all elements where a < b
+  friend inline self_t operator<(const self_t& a, const self_t& b) {
+    return b > a;
+  }
+  //! Returns a mask of all elements where a >= b
+  friend inline self_t operator>=(const self_t& a, const self_t& b) {
+    return ~(b > a);
+  }
+  //! Returns a mask of all elements where a <= b
+  friend inline self_t operator<=(const self_t& a, const self_t& b) {
+    return ~(a > b);
+  }
+
+  // Logical operators
+  //! Bitwise AND of two vectors
+  friend inline self_t operator&(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] & b.data.v[i];
+    return r;
+#else
+    return _mm_and_si128(a, b);
+#endif
+  }
+  //! Bitwise OR of two vectors
+  friend inline self_t operator|(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] | b.data.v[i];
+    return r;
+#else
+    return _mm_or_si128(a, b);
+#endif
+  }
+  //! Bitwise XOR of two vectors
+  friend inline self_t operator^(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = a.data.v[i] ^ b.data.v[i];
+    return r;
+#else
+    return _mm_xor_si128(a, b);
+#endif
+  }
+  //! Bitwise NOT of a vector
+  friend inline self_t operator~(const self_t& a) {
+    return a ^ self_t(scalar_t(-1));
+  }
+  //! Bitwise ANDNOT of two vectors, ~a & b
+  friend inline self_t and_not(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = ~a.data.v[i] & b.data.v[i];
+    return r;
+#else
+    return _mm_andnot_si128(a, b);
+#endif
+  }
+
+  // Shifts
+  //! Shift all elements of a left by n bits
+  friend inline self_t operator<<(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = n < 64 ? scalar_t(u64(a.data.v[i]) << n) : 0;
+    return r;
+#else
+    return _mm_sll_epi64(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in zeros
+  friend inline self_t operator>>(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = n < 64 ? scalar_t(u64(a.data.v[i]) >> n) : 0;
+    return r;
+#else
+    return _mm_srl_epi64(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+
+  // General functions
+  //! Blend two vectors, taking elements from a where mask is set
+  friend inline self_t blend(const self_t& a, const self_t& b, const self_t& mask) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    return (a & mask) | and_not(mask, b);
+#else
+    return _mm_blendv_epi8(b, a, mask);
+#endif
+  }
+  //! Elementwise maximum of a and b
+  friend inline self_t max(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = SVL_MAX(a.data.v[i], b.data.v[i]);
+    return r;
+#elif SVL_SIMD_LEVEL < SVL_AVX512
+    return blend(a, b, a > b);
+#else
+    return _mm_max_epu64(a, b);
+#endif
+  }
+  //! Elementwise minimum of a and b
+  friend inline self_t min(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r;
+    SVL_FOR_RANGE(step) r.data.v[i] = SVL_MIN(a.data.v[i], b.data.v[i]);
+    return r;
+#elif SVL_SIMD_LEVEL < SVL_AVX512
+    return blend(a, b, a < b);
+#else
+    return _mm_min_epu64(a, b);
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i], wrapping on
+  //! overflow
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_SSE
+    self_t r = a;
+    for (i64 i = 1; i < step; ++i)
+      r.data.v[i] = scalar_t(u64(r.data.v[i - 1]) + u64(r.data.v[i]));
+    return r;
+#else
+    return _mm_add_epi64(a, _mm_slli_si128(a, 8));
+#endif
+  }
+};
+
+#ifdef DEBUG
+static inline std::ostream& operator<<(std::ostream& os, const Vector2u64& v) {
+  os << "<";
+  SVL_FOR_RANGE(v.step) os << v[i] << ((i < (v.step - 1)) ? ", " : "");
+  os << ">";
+  return os;
+}
+#endif
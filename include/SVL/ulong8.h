@@ -0,0 +1,330 @@
+#ifndef __SVL_HEADER_INCLUDED__
+#error Please include the SVL.h header only
+#endif
+
+struct Vector8u64 {
+  // Comparisons give masks with all 64 bits of a lane set
+  VECTOR_NUMBER_SETUP(Vector8u64, 8, Vector8u64, u64, Vector4u64);
+
+#if SVL_SIMD_LEVEL < SVL_AVX512
+  using intrinsic_t = struct { half_t v0_3, v4_7; };
+#else
+  using intrinsic_t = __m512i;
+#endif
+  intrinsic_t data;
+
+  static self_t zeros() {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(half_t::zeros(), half_t::zeros());
+#else
+    return _mm512_setzero_si512();
+#endif
+  }
+
+  // Constructors
+  //! Default constructor
+  Vector8u64() = default;
+  //! Copy constructor
+  Vector8u64(const self_t&) = default;
+  //! Move constructor
+  Vector8u64(self_t&&) = default;
+  //! Copy assignment
+  self_t& operator=(const self_t&) = default;
+  //! Move assignment
+  self_t& operator=(self_t&&) = default;
+  //! Destructor
+  ~Vector8u64() = default;
+
+  //! Construct from an array
+  Vector8u64(const scalar_t* arr) { load(arr); }
+  //! Broadcast a value to all elements
+  Vector8u64(scalar_t v) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data = { half_t(v), half_t(v) };
+#else
+    data = _mm512_set1_epi64(i64(v));
+#endif
+  }
+  //! Construct from two Vector4u64s
+  Vector8u64(const half_t& a, const half_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data = { a, b };
+#else
+    data = _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+#endif
+  }
+  //! Convert from intrinsic type
+  Vector8u64(const intrinsic_t& v) : data(v) { }
+  //! Covert to intrinsic type
+  operator intrinsic_t() const { return data; }
+  //! Assign from intrinsic type
+  self_t& operator=(const intrinsic_t& v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Assign from scalar type
+  self_t& operator=(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+
+  // Load/save data
+  //! Load values from an array
+  self_t& load(const scalar_t* arr) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_3.load(arr);
+    data.v4_7.load(arr + half_step);
+#else
+    data = _mm512_loadu_si512((const __m512i*)arr);
+#endif
+    return *this;
+  }
+  //! Load n values from an array. Rest of data will be set to 0
+  self_t& load_partial(const scalar_t* arr, i64 n) {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_3.load_partial(arr, n);
+    data.v4_7.load_partial(arr + half_step, SVL_MAX(0, n - half_step));
+    return *this;
+#else
+    scalar_t tmp[step] = { };
+    memcpy(tmp, arr, n * sizeof(scalar_t));
+    return load(tmp);
+#endif
+  }
+  //! Load and broadcast a value to all elements
+  self_t& broadcast(scalar_t v) {
+    *this = self_t(v);
+    return *this;
+  }
+  //! Store values in an array
+  void store(scalar_t* arr) const {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    data.v0_3.store(arr);
+    data.v4_7.store(arr + half_step);
+#else
+    _mm512_storeu_si512((__m512i*)arr, data);
+#endif
+  }
+  //! Store n values in an array
+  void store_partial(scalar_t* arr, i64 n) const {
+    n = SVL_CLAMP(0, n, step);
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    if (n <= half_step) data.v0_3.store_partial(arr, n);
+    else {
+      data.v0_3.store(arr);
+      data.v4_7.store_partial(arr + half_step, n - half_step);
+    }
+#else
+    scalar_t tmp[step];
+    store(tmp);
+    memcpy(arr, tmp, n * sizeof(scalar_t));
+#endif
+  }
+
+  // Access single value
+  //! RO access to a single value
+  scalar_t access(i64 idx) const {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    return tmp[idx];
+  }
+  //! RO access to a single value
+  scalar_t operator[](i64 idx) const { return access(idx); }
+  //! Assign a single value
+  self_t& assign(scalar_t v, i64 idx) {
+    idx = SVL_CLAMP(0, idx, step - 1);
+    scalar_t tmp[step];
+    store(tmp);
+    tmp[idx] = v;
+    return load(tmp);
+  }
+
+  // Arithmetic operators, wrapping on overflow
+  //! Addition of two vectors
+  friend inline self_t operator+(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 + b.data.v0_3, a.data.v4_7 + b.data.v4_7);
+#else
+    return _mm512_add_epi64(a, b);
+#endif
+  }
+  //! Inplace addition of two vectors
+  friend inline self_t& operator+=(self_t& a, const self_t& b) {
+    a = a + b;
+    return a;
+  }
+  //! Subtraction of two vectors
+  friend inline self_t operator-(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 - b.data.v0_3, a.data.v4_7 - b.data.v4_7);
+#else
+    return _mm512_sub_epi64(a, b);
+#endif
+  }
+  //! Inplace subtraction of two vectors
+  friend inline self_t& operator-=(self_t& a, const self_t& b) {
+    a = a - b;
+    return a;
+  }
+  //! Low 64 bits of the products of a and b
+  friend inline self_t operator*(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 * b.data.v0_3, a.data.v4_7 * b.data.v4_7);
+#else
+    return _mm512_mullo_epi64(a, b);
+#endif
+  }
+  //! Inplace multiplication of two vectors
+  friend inline self_t& operator*=(self_t& a, const self_t& b) {
+    a = a * b;
+    return a;
+  }
+
+  // Comparison operators
+  //! Returns a mask of all elements where a == b
+  friend inline self_t operator==(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 == b.data.v0_3, a.data.v4_7 == b.data.v4_7);
+#else
+    return _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b));
+#endif
+  }
+  //! Returns a mask of all elements where a != b
+  friend inline self_t operator!=(const self_t& a, const self_t& b) {
+    return ~(a == b);
+  }
+  //! Returns a mask of all elements where a > b
+  friend inline self_t operator>(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 > b.data.v0_3, a.data.v4_7 > b.data.v4_7);
+#else
+    return _mm512_movm_epi64(_mm512_cmpgt_epu64_mask(a, b));
+#endif
+  }
+  //! Returns a mask of all elements where a < b
+  friend inline self_t operator<(const self_t& a, const self_t& b) {
+    return b > a;
+  }
+  //! Returns a mask of all elements where a >= b
+  friend inline self_t operator>=(const self_t& a, const self_t& b) {
+    return ~(b > a);
+  }
+  //! Returns a mask of all elements where a <= b
+  friend inline self_t operator<=(const self_t& a, const self_t& b) {
+    return ~(a > b);
+  }
+
+  // Logical operators
+  //! Bitwise AND of two vectors
+  friend inline self_t operator&(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 & b.data.v0_3, a.data.v4_7 & b.data.v4_7);
+#else
+    return _mm512_and_si512(a, b);
+#endif
+  }
+  //! Bitwise OR of two vectors
+  friend inline self_t operator|(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 | b.data.v0_3, a.data.v4_7 | b.data.v4_7);
+#else
+    return _mm512_or_si512(a, b);
+#endif
+  }
+  //! Bitwise XOR of two vectors
+  friend inline self_t operator^(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 ^ b.data.v0_3, a.data.v4_7 ^ b.data.v4_7);
+#else
+    return _mm512_xor_si512(a, b);
+#endif
+  }
+  //! Bitwise NOT of a vector
+  friend inline self_t operator~(const self_t& a) {
+    return a ^ self_t(scalar_t(-1));
+  }
+  //! Bitwise ANDNOT of two vectors, ~a & b
+  friend inline self_t and_not(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(and_not(a.data.v0_3, b.data.v0_3),
+                  and_not(a.data.v4_7, b.data.v4_7));
+#else
+    return _mm512_andnot_si512(a, b);
+#endif
+  }
+
+  // Shifts
+  //! Shift all elements of a left by n bits
+  friend inline self_t operator<<(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 << n, a.data.v4_7 << n);
+#else
+    return _mm512_sll_epi64(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+  //! Shift all elements of a right by n bits, shifting in zeros
+  friend inline self_t operator>>(const self_t& a, i32 n) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(a.data.v0_3 >> n, a.data.v4_7 >> n);
+#else
+    return _mm512_srl_epi64(a, _mm_cvtsi32_si128(n));
+#endif
+  }
+
+  // General functions
+  //! Blend two vectors, taking elements from a where mask is set
+  friend inline self_t blend(const self_t& a, const self_t& b, const self_t& mask) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(blend(a.data.v0_3, b.data.v0_3, mask.data.v0_3),
+                  blend(a.data.v4_7, b.data.v4_7, mask.data.v4_7));
+#else
+    return _mm512_mask_blend_epi64(_mm512_movepi64_mask(mask), b, a);
+#endif
+  }
+  //! Elementwise maximum of a and b
+  friend inline self_t max(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(max(a.data.v0_3, b.data.v0_3),
+                  max(a.data.v4_7, b.data.v4_7));
+#else
+    return _mm512_max_epu64(a, b);
+#endif
+  }
+  //! Elementwise minimum of a and b
+  friend inline self_t min(const self_t& a, const self_t& b) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    return self_t(min(a.data.v0_3, b.data.v0_3),
+                  min(a.data.v4_7, b.data.v4_7));
+#else
+    return _mm512_min_epu64(a, b);
+#endif
+  }
+  //! Inclusive prefix sum, element i is a[0] + ... + a[i], wrapping on
+  //! overflow
+  friend inline self_t prefix_sum(const self_t& a) {
+#if SVL_SIMD_LEVEL < SVL_AVX512
+    half_t lo = prefix_sum(a.data.v0_3);
+    return self_t(lo, prefix_sum(a.data.v4_7) + half_t(lo[half_step - 1]));
+#else
+    // Add within each 128 bit lane, then scan the lane totals and add those of
+    // the lanes below to each lane
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i x = _mm512_add_epi64(a, _mm512_bslli_epi128(a, 8));
+    __m512i t = _mm512_unpackhi_epi64(x, x);
+    t = _mm512_add_epi64(t, _mm512_alignr_epi64(t, zero, 6));
+    t = _mm512_add_epi64(t, _mm512_alignr_epi64(t, zero, 4));
+    return _mm512_add_epi64(x, _mm512_alignr_epi64(t, zero, 6));
+#endif
+  }
+};
+
+#ifdef DEBUG
+static inline std::ostream& operator<<(std::ostream& os, const Vector8u64& v) {
+  os << "<";
+  SVL_FOR_RANGE(v.step) os << v[i] << ((i < (v.step - 1)) ? ", " : "");
+  os << ">";
+  return os;
+}
+#endif
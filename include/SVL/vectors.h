@@ -2,6 +2,22 @@
 #include "bool8.h"
 #include "bool16.h"
 
+#include "short8.h"
+#include "short16.h"
+#include "short32.h"
+
+#include "byte16.h"
+#include "byte32.h"
+#include "byte64.h"
+
+#include "long2.h"
+#include "long4.h"
+#include "long8.h"
+
+#include "ulong2.h"
+#include "ulong4.h"
+#include "ulong8.h"
+
 #include "integer4.h"
 #include "integer8.h"
 #include "integer16.h"
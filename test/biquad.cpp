@@ -0,0 +1,117 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+static std::vector<flt> random_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = dis(gen);
+  return v;
+}
+
+//! Resonant low pass section with cutoff at frequency, a fraction of the
+//! sample rate, and quality factor q
+static SVL::BiquadCoefficients lowpass(dbl frequency, dbl q) {
+  const dbl w = 6.283185307179586477 * frequency, alpha = std::sin(w) / (2. * q);
+  const dbl cw = std::cos(w), a0 = 1. + alpha;
+  SVL::BiquadCoefficients c;
+  c.b0 = flt((1. - cw) / 2. / a0);
+  c.b1 = flt((1. - cw) / a0);
+  c.b2 = c.b0;
+  c.a1 = flt(-2. * cw / a0);
+  c.a2 = flt((1. - alpha) / a0);
+  return c;
+}
+
+//! The cascade of sections applied to x, in double precision
+static std::vector<dbl> reference(const std::vector<flt>& x,
+                                  const std::vector<SVL::BiquadCoefficients>& sections) {
+  std::vector<dbl> y(x.begin(), x.end());
+  for (const SVL::BiquadCoefficients& c : sections) {
+    dbl s1 = 0., s2 = 0.;
+    for (dbl& v : y) {
+      const dbl in = v;
+      v = c.b0 * in + s1;
+      s1 = c.b1 * in - c.a1 * v + s2;
+      s2 = c.b2 * in - c.a2 * v;
+    }
+  }
+  return y;
+}
+
+//! Sections for channel, each different
+static std::vector<SVL::BiquadCoefficients> channel_sections(i64 channel, i64 count) {
+  std::vector<SVL::BiquadCoefficients> sections;
+  for (i64 s = 0; s < count; ++s)
+    sections.push_back(lowpass(0.01 + 0.03 * dbl((channel * 7 + s * 3) % 11),
+                               0.6 + 0.4 * dbl(s)));
+  return sections;
+}
+
+TEST_SUITE_BEGIN("Biquad");
+TEST_CASE_TEMPLATE("channel banks", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  const i64 n = 700, sections = 3;
+  for (i64 channels : { 1, 8, 11, 16, 37, 64 }) {
+    CAPTURE(channels);
+    SVL::BiquadBank<V> bank(channels, sections);
+    std::vector<flt> x = random_input(n * channels, 1);
+    std::vector<std::vector<dbl>> expected(channels);
+    for (i64 c = 0; c < channels; ++c) {
+      std::vector<SVL::BiquadCoefficients> coeffs = channel_sections(c, sections);
+      for (i64 s = 0; s < sections; ++s) bank.set(c, s, coeffs[s]);
+      std::vector<flt> channel(n);
+      for (i64 t = 0; t < n; ++t) channel[t] = x[t * channels + c];
+      expected[c] = reference(channel, coeffs);
+    }
+    // In uneven blocks, carrying the state between them
+    std::vector<flt> y = x;
+    for (i64 t = 0, size = 1; t < n; t += size, size = size * 3 + 1)
+      bank.process(SVL_MIN(size, n - t), y.data() + t * channels);
+    for (i64 c = 0; c < channels; ++c)
+      for (i64 t = 0; t < n; ++t) {
+        CAPTURE(c);
+        CAPTURE(t);
+        CHECK(std::abs(y[t * channels + c] - expected[c][t]) <= 1e-5);
+      }
+
+    // Starting again from zero state gives the same outputs
+    bank.reset();
+    std::vector<flt> again = x;
+    bank.process(n, again.data());
+    CHECK(std::equal(again.begin(), again.end(), y.begin(), [](flt a, flt b) {
+      return std::abs(a - b) <= 1e-5f;
+    }));
+  }
+}
+
+TEST_CASE_TEMPLATE("time blocked single channel", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  const i64 n = 3001;
+  std::vector<SVL::BiquadCoefficients> coeffs = channel_sections(2, 4);
+  // A sharp resonance too
+  coeffs.push_back(lowpass(0.05, 8.));
+  std::vector<flt> x = random_input(n, 2);
+  std::vector<dbl> expected = reference(x, coeffs);
+
+  SVL::BlockBiquad<V> filter(coeffs);
+  std::vector<flt> y = x;
+  for (i64 t = 0, size = 3; t < n; t += size, size = size * 2 + 1)
+    filter.process(SVL_MIN(size, n - t), y.data() + t);
+  for (i64 t = 0; t < n; ++t) {
+    CAPTURE(t);
+    CHECK(std::abs(y[t] - expected[t]) <= 1e-4 * SVL_MAX(1., std::abs(expected[t])));
+  }
+
+  filter.reset();
+  std::vector<flt> again = x;
+  filter.process(n, again.data());
+  for (i64 t = 0; t < n; ++t)
+    CHECK(std::abs(again[t] - expected[t]) <= 1e-4 * SVL_MAX(1., std::abs(expected[t])));
+}
+TEST_SUITE_END();
@@ -0,0 +1,93 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Small integers, so sums and products are exact whatever the order
+static std::vector<flt> blas_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_int_distribution<int> dis(-20, 20);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = flt(dis(gen));
+  return v;
+}
+
+TEST_SUITE_BEGIN("Blas");
+TEST_CASE_TEMPLATE("contiguous and strided", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 n : { 0, 1, 7, 16, 33, 130, 1001 }) {
+    // Strided backwards from the end of the array too
+    for (i64 inc : { 1, 3, -2 }) {
+      CAPTURE(n);
+      CAPTURE(inc);
+      const i64 size = n * std::abs(inc) + 1;
+      std::vector<flt> xs = blas_input(size, 1), ys = blas_input(size, 2);
+      flt* x = inc > 0 ? xs.data() : xs.data() + size - 1;
+      flt* y = inc > 0 ? ys.data() : ys.data() + size - 1;
+
+      flt dot = 0.f, asum = 0.f, sumsq = 0.f;
+      SVL_FOR_RANGE(n) {
+        dot += x[i * inc] * y[i * inc];
+        asum += std::abs(x[i * inc]);
+        sumsq += x[i * inc] * x[i * inc];
+      }
+      CHECK(SVL::dot<V>(n, x, inc, y, inc) == dot);
+      CHECK(SVL::asum<V>(n, x, inc) == asum);
+      CHECK(SVL::nrm2<V>(n, x, inc) == std::sqrt(sumsq));
+      if (inc == 1) CHECK(SVL::dot<V>(n, x, y) == dot);
+
+      // Only the strided elements change
+      std::vector<flt> ref = ys;
+      flt* r = inc > 0 ? ref.data() : ref.data() + size - 1;
+      SVL_FOR_RANGE(n) r[i * inc] += 3.f * x[i * inc];
+      SVL::axpy<V>(n, 3.f, x, inc, y, inc);
+      CHECK(ys == ref);
+      SVL_FOR_RANGE(n) r[i * inc] *= -2.f;
+      SVL::scal<V>(n, -2.f, y, inc);
+      CHECK(ys == ref);
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("nrm2 scaling", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f) {
+  for (flt scale : { 1e-30f, 1e-42f, 1e25f, 1e35f }) {
+    CAPTURE(scale);
+    std::vector<flt> x = blas_input(101, 3);
+    double sumsq = 0.0;
+    for (flt& xi : x) {
+      xi *= scale;
+      sumsq += double(xi) * double(xi);
+    }
+    flt ref = flt(std::sqrt(sumsq));
+    CHECK(std::abs(SVL::nrm2<V>(101, x.data()) - ref) <= 1e-5f * ref);
+  }
+  std::vector<flt> x(20, 0.f);
+  CHECK(SVL::nrm2<V>(20, x.data()) == 0.f);
+  x[3] = -std::numeric_limits<flt>::infinity();
+  CHECK(SVL::nrm2<V>(20, x.data()) == std::numeric_limits<flt>::infinity());
+  x[7] = std::numeric_limits<flt>::quiet_NaN();
+  CHECK(std::isnan(SVL::nrm2<V>(20, x.data())));
+}
+
+TEST_CASE_TEMPLATE("iamax", V, SVL::scalar::Vector4f, SVL::sse::Vector8f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  for (i64 n : { 1, 9, 100 }) {
+    for (i64 inc : { 1, 2 }) {
+      CAPTURE(n);
+      CAPTURE(inc);
+      std::vector<flt> x = blas_input(n * inc, 4);
+      // The first of a tie between a negative and a positive value
+      x[(n / 2) * inc] = -50.f;
+      x[(n - 1) * inc] = 50.f;
+      x[0] = std::numeric_limits<flt>::quiet_NaN();
+      i64 expected = n == 1 ? -1 : n / 2;
+      CHECK(SVL::iamax<V>(n, x.data(), inc) == expected);
+    }
+  }
+  CHECK(SVL::iamax<V>(0, nullptr) == -1);
+}
+TEST_SUITE_END();
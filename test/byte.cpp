@@ -0,0 +1,98 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <random>
+
+// Fills a and b with random bytes, including the extremes
+template <typename V>
+static void random_bytes(u8* a, u8* b) {
+  std::mt19937 gen(V::step);
+  std::uniform_int_distribution<int> dis(0, 255);
+  SVL_FOR_RANGE(V::step) {
+    a[i] = u8(dis(gen));
+    b[i] = u8(dis(gen));
+  }
+  a[0] = 255; b[0] = 255;
+  a[1] = 0; b[1] = 255;
+  a[2] = 255; b[2] = 0;
+  a[3] = b[3];
+}
+
+TEST_SUITE_BEGIN("Vecu8");
+TEST_CASE_TEMPLATE("Vecu8 arithmetic", V, SVL::scalar::Vector16u8,
+                   SVL::scalar::Vector32u8, SVL::scalar::Vector64u8,
+                   SVL::sse::Vector16u8, SVL::sse::Vector32u8,
+                   SVL::sse::Vector64u8, SVL::avx2::Vector16u8,
+                   SVL::avx2::Vector32u8, SVL::avx2::Vector64u8) {
+  u8 a[V::step], b[V::step];
+  random_bytes<V>(a, b);
+  V va(a), vb(b);
+
+  struct Op { const char* name; V result; u8 (*ref)(u8, u8); };
+  const Op ops[] = {
+    { "+", va + vb, [](u8 x, u8 y) { return u8(x + y); } },
+    { "-", va - vb, [](u8 x, u8 y) { return u8(x - y); } },
+    { "add_saturated", add_saturated(va, vb),
+      [](u8 x, u8 y) { return u8(SVL_MIN(x + y, 255)); } },
+    { "sub_saturated", sub_saturated(va, vb),
+      [](u8 x, u8 y) { return u8(SVL_MAX(x - y, 0)); } },
+    { "avg", avg(va, vb), [](u8 x, u8 y) { return u8((x + y + 1) >> 1); } },
+    { "min", min(va, vb), [](u8 x, u8 y) { return SVL_MIN(x, y); } },
+    { "max", max(va, vb), [](u8 x, u8 y) { return SVL_MAX(x, y); } },
+    { "mulhi", mulhi(va, vb), [](u8 x, u8 y) { return u8((x * y) >> 8); } },
+    { "==", va == vb, [](u8 x, u8 y) { return u8(x == y ? 0xFF : 0); } },
+    { "!=", va != vb, [](u8 x, u8 y) { return u8(x != y ? 0xFF : 0); } },
+    { "<", va < vb, [](u8 x, u8 y) { return u8(x < y ? 0xFF : 0); } },
+    { "<=", va <= vb, [](u8 x, u8 y) { return u8(x <= y ? 0xFF : 0); } },
+    { ">", va > vb, [](u8 x, u8 y) { return u8(x > y ? 0xFF : 0); } },
+    { ">=", va >= vb, [](u8 x, u8 y) { return u8(x >= y ? 0xFF : 0); } },
+    { "blend", blend(va, vb, va > vb), [](u8 x, u8 y) { return x > y ? x : y; } },
+    { "and_not", and_not(va, vb), [](u8 x, u8 y) { return u8(~x & y); } },
+  };
+  for (const Op& op : ops) {
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(op.name);
+      CAPTURE(i);
+      CHECK(op.result[i] == op.ref(a[i], b[i]));
+    }
+  }
+
+  for (i32 n : { 0, 1, 3, 7, 8 }) {
+    V left = va << n, right = va >> n;
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(n);
+      CAPTURE(i);
+      CHECK(left[i] == u8(n < 8 ? a[i] << n : 0));
+      CHECK(right[i] == u8(n < 8 ? a[i] >> n : 0));
+    }
+  }
+
+  auto pairs = maddubs(va, vb);
+  SVL_FOR_RANGE(V::step / 2) {
+    i32 sum = a[2 * i] * i8(b[2 * i]) + a[2 * i + 1] * i8(b[2 * i + 1]);
+    CAPTURE(i);
+    CHECK(pairs[i] == SVL_CLAMP(-32768, sum, 32767));
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecu8 load and store", V, SVL::scalar::Vector16u8,
+                   SVL::scalar::Vector64u8, SVL::sse::Vector16u8,
+                   SVL::sse::Vector64u8, SVL::avx2::Vector32u8,
+                   SVL::avx2::Vector64u8) {
+  u8 a[V::step], b[V::step], out[V::step + 1];
+  random_bytes<V>(a, b);
+  for (i64 n = 0; n <= V::step; ++n) {
+    CAPTURE(n);
+    memset(out, 0xAB, sizeof(out));
+    V v = V().load_partial(a, n);
+    v.store_partial(out, n);
+    SVL_FOR_RANGE(V::step) CHECK(v[i] == (i < n ? a[i] : 0));
+    SVL_FOR_RANGE(n) CHECK(out[i] == a[i]);
+    CHECK(out[n] == 0xAB);
+  }
+  V v(a);
+  v.assign(42, V::step - 1);
+  CHECK(v[V::step - 1] == 42);
+  CHECK(V(u8(7))[V::step / 2] == 7);
+}
+TEST_SUITE_END();
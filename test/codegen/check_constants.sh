@@ -0,0 +1,32 @@
+#!/bin/sh
+# Compile constants.cpp and check in the generated assembly that every kernel
+# loads its constants from SVL::constant_table, and that none of them moves an
+# immediate into a vector register to rebuild a constant.
+#
+# Usage: test/codegen/check_constants.sh   (CXX selects the compiler)
+
+CXX=${CXX:-c++}
+DIR=$(dirname "$0")
+ASM=$(mktemp)
+trap 'rm -f "$ASM"' EXIT
+
+$CXX -std=c++17 -O2 -mavx2 -mfma -DSVL_USE_AVX2 -I"$DIR/../../include" \
+  -S -o "$ASM" "$DIR/constants.cpp" || exit 1
+
+status=0
+for kernel in $(grep -o '^kernel_[a-z0-9_]*:' "$ASM" | tr -d :); do
+  failed=0
+  body=$(awk -v k="$kernel:" '$1 == k { on = 1; next } on && /\.cfi_endproc|^\t\.size/ { exit } on' "$ASM")
+  if ! echo "$body" | grep -q 'constant_table'; then
+    echo "FAIL $kernel: no constant loaded from constant_table"
+    failed=1
+  fi
+  rebuilt=$(echo "$body" | grep -E 'vmov[dq][[:space:]]+%[er]|v(p)?broadcast[a-z]*[[:space:]]+%xmm')
+  if [ -n "$rebuilt" ]; then
+    echo "FAIL $kernel: constant built from an immediate"
+    echo "$rebuilt"
+    failed=1
+  fi
+  if [ $failed -eq 0 ]; then echo "ok   $kernel"; else status=1; fi
+done
+exit $status
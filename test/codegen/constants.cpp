@@ -0,0 +1,21 @@
+// Kernels whose generated code check_constants.sh inspects. Each must take
+// its constants from SVL::constant_table rather than building them from
+// immediates
+#include <SVL/SVL.h>
+
+using V = SVL::avx2::Vector8f;
+
+extern "C" {
+void kernel_abs(const flt* a, flt* out) { abs(V(a)).store(out); }
+void kernel_acos(const flt* a, flt* out) { acos(V(a)).store(out); }
+void kernel_atan2(const flt* a, const flt* b, flt* out) {
+  atan2(V(a), V(b)).store(out);
+}
+void kernel_pow2n(const flt* a, flt* out) { pow2n(V(a)).store(out); }
+void kernel_exponent(const flt* a, flt* out) { exponent(V(a)).store(out); }
+void kernel_fraction(const flt* a, flt* out) { fraction(V(a)).store(out); }
+void kernel_fast_sin(const flt* a, flt* out) { SVL::fast::sin(V(a)).store(out); }
+void kernel_fast_exp(const flt* a, flt* out) { SVL::fast::exp(V(a)).store(out); }
+void kernel_fast_log(const flt* a, flt* out) { SVL::fast::log(V(a)).store(out); }
+void kernel_fast_atan(const flt* a, flt* out) { SVL::fast::atan(V(a)).store(out); }
+}
@@ -0,0 +1,168 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using cflt = std::complex<flt>;
+using cdbl = std::complex<dbl>;
+
+static std::vector<cflt> complex_input(i64 n, u32 seed, flt lo = -4.f, flt hi = 4.f) {
+  std::mt19937 gen{ seed };
+  std::uniform_real_distribution<flt> dis(lo, hi);
+  std::vector<cflt> v(n);
+  for (cflt& x : v) x = cflt(dis(gen), dis(gen));
+  return v;
+}
+
+// Small whole numbers, so products and sums are exact whatever the order
+static std::vector<cflt> exact_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_int_distribution<int> dis(-20, 20);
+  std::vector<cflt> v(n);
+  for (cflt& x : v) x = cflt(flt(dis(gen)), flt(dis(gen)));
+  return v;
+}
+
+//! Whether got is within tol of expected, relative to |expected|
+static bool close(cflt got, cdbl expected, dbl tol = 0x1p-21) {
+  return std::abs(cdbl(got) - expected) <= tol * std::abs(expected);
+}
+
+TEST_SUITE_BEGIN("Complex");
+TEST_CASE_TEMPLATE("split and interleaved arithmetic", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector4f, SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  using S = SVL::SplitComplex<V>;
+  using I = SVL::InterleavedComplex<V>;
+  const i64 n = V::step;
+  std::vector<cflt> a = complex_input(n, 1), b = complex_input(n, 2);
+  S sa(a.data()), sb(b.data());
+  I ia(a.data()), ib(b.data());
+
+  // Loading and converting between the layouts is exact
+  S back(ia);
+  I there(sa);
+  SVL_FOR_RANGE(n) {
+    CAPTURE(i);
+    CHECK(sa[i] == a[i]);
+    CHECK(ia[i] == a[i]);
+    CHECK(back[i] == a[i]);
+    CHECK(there[i] == a[i]);
+  }
+
+  S sum = sa + sb, diff = sa - sb, prod = sa * sb, quot = sa / sb, c = conj(sa);
+  S mac = fma(sa, sb, sb);
+  I isum = ia + ib, idiff = ia - ib, iprod = ia * ib, iquot = ia / ib, ic = conj(ia);
+  V nrm = norm(sa), mag = abs(sa), phase = arg(sa);
+  SVL_FOR_RANGE(n) {
+    CAPTURE(i);
+    cdbl x(a[i]), y(b[i]);
+    CHECK(sum[i] == a[i] + b[i]);
+    CHECK(isum[i] == a[i] + b[i]);
+    CHECK(diff[i] == a[i] - b[i]);
+    CHECK(idiff[i] == a[i] - b[i]);
+    CHECK(c[i] == std::conj(a[i]));
+    CHECK(ic[i] == std::conj(a[i]));
+    CHECK(close(prod[i], x * y));
+    CHECK(close(iprod[i], x * y));
+    CHECK(close(mac[i], x * y + y));
+    CHECK(close(quot[i], x / y));
+    CHECK(close(iquot[i], x / y));
+    CHECK(std::abs(nrm[i] - std::norm(x)) <= 0x1p-22 * std::norm(x));
+    CHECK(std::abs(mag[i] - std::abs(x)) <= 0x1p-22 * std::abs(x));
+    CHECK(std::abs(phase[i] - std::arg(x)) <= 0x1p-20);
+  }
+
+  // exp over a wide range of phases
+  std::vector<cflt> e = complex_input(n, 3, -20.f, 20.f);
+  S ex = exp(S(e.data()));
+  SVL_FOR_RANGE(n) {
+    CAPTURE(e[i]);
+    CHECK(close(ex[i], std::exp(cdbl(e[i])), 0x1p-20));
+  }
+}
+
+TEST_CASE_TEMPLATE("special values", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f) {
+  using S = SVL::SplitComplex<V>;
+  using I = SVL::InterleavedComplex<V>;
+  // Divisors whose squared magnitude overflows or underflows
+  for (flt scale : { 1e30f, 1e-30f, 3e38f, 1e-40f }) {
+    CAPTURE(scale);
+    std::vector<cflt> a = complex_input(V::step, 4), b = complex_input(V::step, 5, -1.f, 1.f);
+    for (cflt& y : b) y *= scale;
+    S quot = S(a.data()) / S(b.data());
+    I iquot = I(a.data()) / I(b.data());
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(b[i]);
+      cdbl expected = cdbl(a[i]) / cdbl(b[i]);
+      if (std::abs(expected) > 3.4e38) {
+        CHECK(std::isinf(std::abs(quot[i])));
+        CHECK(std::isinf(std::abs(iquot[i])));
+        continue;
+      }
+      // Denormal results lose precision, but not their scale
+      dbl tol = std::abs(expected) < 1e-37 ? 0x1p-10 : 0x1p-21;
+      CHECK(close(quot[i], expected, tol));
+      CHECK(close(iquot[i], expected, tol));
+    }
+  }
+  // Magnitudes don't overflow unless the result does
+  std::vector<cflt> big = complex_input(V::step, 6, 1e37f, 2e38f);
+  V mag = abs(S(big.data()));
+  SVL_FOR_RANGE(V::step)
+    CHECK(std::abs(mag[i] - std::abs(cdbl(big[i]))) <= 0x1p-22 * std::abs(cdbl(big[i])));
+  // exp of real numbers stays real, even when it overflows
+  S r = exp(S(V(100.f)));
+  S z = exp(S(V(0.f), V(-0.f)));
+  SVL_FOR_RANGE(V::step) {
+    CHECK(r[i] == cflt(HUGE_VALF, 0.f));
+    CHECK(z[i] == cflt(1.f, 0.f));
+    CHECK(std::signbit(z.im[i]));
+  }
+}
+
+TEST_CASE_TEMPLATE("partial loads and stores", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  using S = SVL::SplitComplex<V>;
+  using I = SVL::InterleavedComplex<V>;
+  std::vector<cflt> a = complex_input(V::step, 7);
+  for (i64 m = 0; m <= V::step; ++m) {
+    CAPTURE(m);
+    S s = S().load_partial(a.data(), m);
+    I in = I().load_partial(a.data(), m);
+    std::vector<cflt> out_s(V::step, cflt(-1.f, -1.f)), out_i = out_s;
+    s.store_partial(out_s.data(), m);
+    in.store_partial(out_i.data(), m);
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(i);
+      cflt expected = i < m ? a[i] : cflt(0.f, 0.f);
+      CHECK(s[i] == expected);
+      CHECK(in[i] == expected);
+      CHECK(out_s[i] == (i < m ? a[i] : cflt(-1.f, -1.f)));
+      CHECK(out_i[i] == (i < m ? a[i] : cflt(-1.f, -1.f)));
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("array kernels", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 n : { 0, 1, 3, 8, 37, 130 }) {
+    CAPTURE(n);
+    std::vector<cflt> a = exact_input(n, 1), b = exact_input(n, 2), acc = exact_input(n, 3);
+    std::vector<cflt> prod(n), mac = acc;
+    cflt dot = 0.f;
+    SVL_FOR_RANGE(n) dot += a[i] * b[i];
+    SVL::complex_multiply<V>(n, a.data(), b.data(), prod.data());
+    SVL::complex_mac<V>(n, a.data(), b.data(), mac.data());
+    SVL_FOR_RANGE(n) {
+      CAPTURE(i);
+      CHECK(prod[i] == a[i] * b[i]);
+      CHECK(mac[i] == acc[i] + a[i] * b[i]);
+    }
+    CHECK(SVL::complex_dot<V>(n, a.data(), b.data()) == dot);
+  }
+}
+TEST_SUITE_END();
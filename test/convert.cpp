@@ -0,0 +1,175 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+#include "ulp.h"
+
+#include <vector>
+
+// Reference rounding of a float to the nearest half or bfloat16 value through
+// double, with ties to even. Only valid for finite values that do not round
+// to infinity
+static double round_to_format(double x, int mantissa_bits, int min_exponent) {
+  if (x == 0.) return x;
+  int e;
+  std::frexp(x, &e);
+  double quantum = std::ldexp(1., SVL_MAX(e, min_exponent) - 1 - mantissa_bits);
+  return std::nearbyint(x / quantum) * quantum;
+}
+
+TEST_SUITE_BEGIN("16 bit floats");
+TEST_CASE("scalar f16 conversions") {
+  // Every half value survives a round trip through float
+  for (u32 h = 0; h < 0x10000; ++h) {
+    flt f = SVL::f16_to_float(u16(h));
+    CAPTURE(h);
+    if (std::isnan(f)) CHECK(SVL::float_to_f16(f) == (h | 0x200));
+    else CHECK(SVL::float_to_f16(f) == h);
+  }
+  CHECK(SVL::f16_to_float(0x3c00) == 1.f);
+  CHECK(SVL::f16_to_float(0x0001) == std::ldexp(1.f, -24));
+  CHECK(SVL::f16_to_float(0xfc00) == -HUGE_VALF);
+  CHECK(SVL::float_to_f16(65504.f) == 0x7bff);
+  CHECK(SVL::float_to_f16(65519.f) == 0x7bff);
+  CHECK(SVL::float_to_f16(65520.f) == 0x7c00);
+  CHECK(SVL::float_to_f16(-1e10f) == 0xfc00);
+  CHECK(SVL::float_to_f16(std::ldexp(1.f, -25)) == 0);
+  CHECK(SVL::float_to_f16(std::ldexp(1.5f, -25)) == 1);
+  CHECK(SVL::float_to_f16(-0.f) == 0x8000);
+
+  // Rounding of every float with a prime stride
+  for (u64 bits = 0; bits < (u64(1) << 32); bits += 997) {
+    flt f = float_from_bits(u32(bits));
+    if (!std::isfinite(f) || std::fabs(f) >= 65520.f) continue;
+    CAPTURE(f);
+    REQUIRE(SVL::f16_to_float(SVL::float_to_f16(f)) == round_to_format(f, 10, -13));
+  }
+}
+
+TEST_CASE("scalar bf16 conversions") {
+  for (u32 h = 0; h < 0x10000; ++h) {
+    flt f = SVL::bf16_to_float(u16(h));
+    CAPTURE(h);
+    if (std::isnan(f)) CHECK(SVL::float_to_bf16(f) == (h | 0x40));
+    else CHECK(SVL::float_to_bf16(f) == h);
+  }
+  CHECK(SVL::float_to_bf16(1.f + std::ldexp(1.f, -8)) == 0x3f80);
+  CHECK(SVL::float_to_bf16(1.f + std::ldexp(3.f, -8)) == 0x3f82);
+  CHECK(SVL::float_to_bf16(3.4e38f) == 0x7f80);
+  CHECK(SVL::float_to_bf16(float_from_bits(0x7fffffff)) == 0x7fff);
+
+  for (u64 bits = 0; bits < (u64(1) << 32); bits += 997) {
+    flt f = float_from_bits(u32(bits));
+    if (!std::isfinite(f) || std::fabs(f) >= 3.3895e38f) continue;
+    CAPTURE(f);
+    REQUIRE(SVL::bf16_to_float(SVL::float_to_bf16(f)) == round_to_format(f, 7, -125));
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecf 16 bit loads and stores", V, SVL::scalar::Vector4f,
+                   SVL::scalar::Vector8f, SVL::scalar::Vector16f,
+                   SVL::sse::Vector4f, SVL::sse::Vector8f, SVL::sse::Vector16f,
+                   SVL::avx2::Vector4f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  // Every float with a prime stride plus the special values, checked against
+  // the scalar conversions
+  std::vector<flt> values(std::begin(special_values), std::end(special_values));
+  for (u64 bits = 0; bits < (u64(1) << 32); bits += 65537 * 31)
+    values.push_back(float_from_bits(u32(bits)));
+  values.push_back(1.f + std::ldexp(1.f, -11));
+  values.push_back(1.f + std::ldexp(1.f, -8));
+  values.resize((values.size() / V::step) * V::step);
+
+  for (size_t j = 0; j < values.size(); j += V::step) {
+    V v(&values[j]);
+    u16 f16[V::step], bf16[V::step];
+    v.store_f16(f16);
+    v.store_bf16(bf16);
+    flt wide_f16[V::step], wide_bf16[V::step];
+    V().load_f16(f16).store(wide_f16);
+    V().load_bf16(bf16).store(wide_bf16);
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(values[j + i]);
+      CHECK(f16[i] == SVL::float_to_f16(values[j + i]));
+      CHECK(bf16[i] == SVL::float_to_bf16(values[j + i]));
+      CHECK(same_kind(wide_f16[i], SVL::f16_to_float(f16[i])));
+      CHECK(same_kind(wide_bf16[i], SVL::bf16_to_float(bf16[i])));
+    }
+  }
+}
+
+TEST_CASE("16 bit float buffer conversions") {
+  std::vector<flt> in(1000), out(1001, -1.f);
+  std::vector<u16> half(1001, 0xabcd);
+  SVL_FOR_RANGE(1000) in[i] = flt(i) * 0.37f - 150.f;
+  for (i64 n : { 0, 1, 7, 8, 9, 999 }) {
+    CAPTURE(n);
+    SVL::convert_float_to_f16(half.data(), in.data(), n);
+    SVL::convert_f16_to_float(out.data(), half.data(), n);
+    SVL_FOR_RANGE(n) CHECK(out[i] == SVL::f16_to_float(SVL::float_to_f16(in[i])));
+    CHECK(half[n] == 0xabcd);
+    CHECK(out[n] == -1.f);
+    SVL::convert_float_to_bf16<SVL::sse::Vector4f>(half.data(), in.data(), n);
+    SVL::convert_bf16_to_float<SVL::sse::Vector4f>(out.data(), half.data(), n);
+    SVL_FOR_RANGE(n) CHECK(out[i] == SVL::bf16_to_float(SVL::float_to_bf16(in[i])));
+    CHECK(half[n] == 0xabcd);
+    CHECK(out[n] == -1.f);
+  }
+}
+TEST_SUITE_END();
+
+// Rounds to nearest even and saturates, with NaN going to low
+static double saturate(flt x, double low, double high) {
+  if (std::isnan(x)) return low;
+  return std::nearbyint(SVL_CLAMP(low, double(x), high));
+}
+
+TEST_SUITE_BEGIN("Integer storage");
+TEST_CASE_TEMPLATE("Vecf integer loads and saturating stores", V,
+                   SVL::scalar::Vector4f, SVL::scalar::Vector8f,
+                   SVL::scalar::Vector16f, SVL::sse::Vector4f,
+                   SVL::sse::Vector8f, SVL::sse::Vector16f,
+                   SVL::avx2::Vector4f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  u8 u8s[V::step];
+  i8 i8s[V::step];
+  u16 u16s[V::step];
+  i16 i16s[V::step];
+  i32 i32s[V::step];
+  SVL_FOR_RANGE(V::step) {
+    u8s[i] = u8(255 - i * 13);
+    i8s[i] = i8(-128 + i * 17);
+    u16s[i] = u16(65535 - i * 4099);
+    i16s[i] = i16(-32768 + i * 4111);
+    i32s[i] = i32(-2147483647 + i * 268435455);
+  }
+  V vu8 = V().load_u8(u8s), vi8 = V().load_i8(i8s), vu16 = V().load_u16(u16s),
+    vi16 = V().load_i16(i16s), vi32 = V().load_i32(i32s);
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(i);
+    CHECK(vu8[i] == flt(u8s[i]));
+    CHECK(vi8[i] == flt(i8s[i]));
+    CHECK(vu16[i] == flt(u16s[i]));
+    CHECK(vi16[i] == flt(i16s[i]));
+    CHECK(vi32[i] == flt(i32s[i]));
+  }
+
+  // Ties, values just outside the ranges, huge values and NaN
+  const flt values[] = { 0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 254.5f, 255.5f, 256.f,
+                         -1.f, 3e9f, -3e9f, 32766.5f, 32767.5f, -32768.5f,
+                         -32769.f, 1e30f, -1e30f, HUGE_VALF, -HUGE_VALF, NAN,
+                         100.49f, -7.51f, 12345.6f, 0.f };
+  const u64 count = sizeof(values) / sizeof(flt);
+  for (u64 j = 0; j < count; j += V::step) {
+    flt x[V::step];
+    SVL_FOR_RANGE(V::step) x[i] = values[(j + i) % count];
+    u8 bytes[V::step];
+    i16 shorts[V::step];
+    V(x).store_u8_sat(bytes);
+    V(x).store_i16_sat(shorts);
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(x[i]);
+      CHECK(bytes[i] == saturate(x[i], 0., 255.));
+      CHECK(shorts[i] == saturate(x[i], -32768., 32767.));
+    }
+  }
+}
+TEST_SUITE_END();
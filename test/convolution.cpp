@@ -0,0 +1,112 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+static std::vector<flt> random_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = dis(gen);
+  return v;
+}
+
+//! Whether got is within a few roundings of expected, the sum of terms
+//! whose magnitudes add up to scale
+static bool close(flt got, dbl expected, dbl scale) {
+  return std::abs(dbl(got) - expected) <= 0x1p-21 * scale;
+}
+
+TEST_SUITE_BEGIN("Convolution");
+TEST_CASE_TEMPLATE("FIR filters", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 k : { 1, 2, 3, 7, 8, 9, 16, 17, 40 }) {
+    for (i64 n : { 0, 1, 5, 31, 64, 100, 257 }) {
+      CAPTURE(k);
+      CAPTURE(n);
+      std::vector<flt> in = random_input(n + k - 1, 1), taps = random_input(k, 2);
+      // Guard values either side of the output must survive
+      std::vector<flt> out(n + 2, -7.f);
+      SVL::fir<V>(n, in.data(), taps.data(), k, out.data() + 1);
+      CHECK(out[0] == -7.f);
+      CHECK(out[n + 1] == -7.f);
+      for (i64 i = 0; i < n; ++i) {
+        CAPTURE(i);
+        dbl sum = 0., scale = 0.;
+        for (i64 j = 0; j < k; ++j) {
+          sum += dbl(taps[j]) * in[i + k - 1 - j];
+          scale += std::abs(dbl(taps[j]) * in[i + k - 1 - j]);
+        }
+        CHECK(close(out[i + 1], sum, scale));
+      }
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("2D convolutions", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  const i64 rows = 13;
+  for (i64 kr : { 1, 3, 5, 7 }) {
+    for (i64 kc : { 1, 3, 4, 7 }) {
+      for (i64 cols : { 1, 9, 40, 67 }) {
+        CAPTURE(kr);
+        CAPTURE(kc);
+        CAPTURE(cols);
+        const i64 in_stride = cols + kc + 2, out_stride = cols + 3;
+        std::vector<flt> in = random_input((rows + kr - 1) * in_stride, 3);
+        std::vector<flt> row = random_input(kc, 4), column = random_input(kr, 5);
+        std::vector<flt> kernel(kr * kc);
+        for (i64 i = 0; i < kr; ++i)
+          for (i64 j = 0; j < kc; ++j) kernel[i * kc + j] = column[i] * row[j];
+
+        std::vector<flt> general(rows * out_stride, -7.f), separable = general;
+        SVL::conv2d<V>(rows, cols, in.data(), in_stride, kernel.data(), kr, kc, general.data(),
+                       out_stride);
+        SVL::conv2d_separable<V>(rows, cols, in.data(), in_stride, row.data(), kc,
+                                 column.data(), kr, separable.data(), out_stride);
+        for (i64 r = 0; r < rows; ++r) {
+          for (i64 c = 0; c < out_stride; ++c) {
+            CAPTURE(r);
+            CAPTURE(c);
+            if (c >= cols) {
+              CHECK(general[r * out_stride + c] == -7.f);
+              CHECK(separable[r * out_stride + c] == -7.f);
+              continue;
+            }
+            dbl sum = 0., scale = 0.;
+            for (i64 i = 0; i < kr; ++i)
+              for (i64 j = 0; j < kc; ++j) {
+                const dbl term = dbl(column[i]) * row[j] *
+                                 in[(r + kr - 1 - i) * in_stride + c + kc - 1 - j];
+                sum += term;
+                scale += std::abs(term);
+              }
+            CHECK(close(general[r * out_stride + c], sum, scale));
+            CHECK(close(separable[r * out_stride + c], sum, scale));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("row parallel convolutions", V, SVL::sse::Vector4f, SVL::avx2::Vector8f) {
+  // Large enough that every thread gets a band
+  const i64 rows = 301, cols = 700, kr = 5, kc = 5, stride = cols + kc - 1;
+  std::vector<flt> in = random_input((rows + kr - 1) * stride, 6);
+  std::vector<flt> kernel = random_input(kr * kc, 7), row = random_input(kc, 8);
+  std::vector<flt> column = random_input(kr, 9);
+  std::vector<flt> serial(rows * cols), parallel(rows * cols);
+  SVL::conv2d<V>(rows, cols, in.data(), stride, kernel.data(), kr, kc, serial.data(), cols);
+  SVL::parallel_conv2d<V>(rows, cols, in.data(), stride, kernel.data(), kr, kc, parallel.data(),
+                          cols, 4);
+  CHECK(serial == parallel);
+  SVL::conv2d_separable<V>(rows, cols, in.data(), stride, row.data(), kc, column.data(), kr,
+                           serial.data(), cols);
+  SVL::parallel_conv2d_separable<V>(rows, cols, in.data(), stride, row.data(), kc,
+                                    column.data(), kr, parallel.data(), cols, 4);
+  CHECK(serial == parallel);
+}
+TEST_SUITE_END();
@@ -0,0 +1,187 @@
+// As in test/policy.cpp, keep the sse fma a separate multiply and add
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+#include <cstdlib>
+#include "../ulp.h"
+
+// Exhaustive accuracy sweep of every float math function in every SIMD
+// namespace. Unary functions are checked for all 2^32 inputs and binary ones
+// on a dense random sample, so this is built as its own long running target.
+// Set SVL_ULP_STRIDE and SVL_ULP_PAIRS to run a quicker partial sweep
+
+static u64 env_or(const char* name, u64 fallback) {
+  const char* value = std::getenv(name);
+  return value ? std::strtoull(value, nullptr, 10) : fallback;
+}
+
+static const u64 stride = env_or("SVL_ULP_STRIDE", 1);
+static const u64 n_pairs = env_or("SVL_ULP_PAIRS", u64(1) << 28);
+
+template <typename V>
+struct Unary {
+  const char* name;
+  V (*f)(const V&);
+  double (*ref)(double);
+  double bound;
+};
+
+template <typename V>
+struct Binary {
+  const char* name;
+  V (*f)(const V&, const V&);
+  double (*ref)(double, double);
+  double bound;
+};
+
+//! Evaluate f on special_values and report every result of the wrong kind
+template <typename V, typename F, typename R>
+static void check_special_values(const char* name, F f, R ref) {
+  const i64 n = sizeof(special_values) / sizeof(special_values[0]);
+  for (i64 j = 0; j < n; j += V::step) {
+    float out[V::step];
+    i64 m = SVL_MIN(n - j, (i64)V::step);
+    f(V().load_partial(special_values + j, m)).store_partial(out, m);
+    SVL_FOR_RANGE(m) {
+      float x = special_values[j + i];
+      CAPTURE(name);
+      CAPTURE(x);
+      CAPTURE(out[i]);
+      CHECK(same_kind(out[i], ref(double(x))));
+    }
+  }
+}
+
+static void report(const char* name, const ErrorStats& stats) {
+  MESSAGE(name << ": max " << stats.max << " ULP at " << stats.worst_input
+          << ", mean " << stats.mean() << " ULP over " << stats.count
+          << " inputs");
+}
+
+// Bounds are the worst case over all namespaces. Functions the SIMD levels
+// forward to libm are within 0.5 ULP, the AVX2 acos and atan2 polynomials and
+// the fast policy are not
+TEST_SUITE_BEGIN("Exhaustive ULP");
+TEST_CASE_TEMPLATE("Unary float functions", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector8f, SVL::avx2::Vector8f) {
+  const Unary<V> cases[] = {
+    { "sqrt", [](const V& x) { return sqrt(x); },
+      [](double x) { return std::sqrt(x); }, 0.5 },
+    { "sin", [](const V& x) { return sin(x); },
+      [](double x) { return std::sin(x); }, 1. },
+    { "cos", [](const V& x) { return cos(x); },
+      [](double x) { return std::cos(x); }, 1. },
+    { "tan", [](const V& x) { return tan(x); },
+      [](double x) { return std::tan(x); }, 1. },
+    { "asin", [](const V& x) { return asin(x); },
+      [](double x) { return std::asin(x); }, 1. },
+    { "acos", [](const V& x) { return acos(x); },
+      [](double x) { return std::acos(x); }, 1.5 },
+    { "atan", [](const V& x) { return atan(x); },
+      [](double x) { return std::atan(x); }, 1. },
+    { "floor", [](const V& x) { return floor(x); },
+      [](double x) { return std::floor(x); }, 0. },
+    { "ceil", [](const V& x) { return ceil(x); },
+      [](double x) { return std::ceil(x); }, 0. },
+    { "round", [](const V& x) { return round(x); },
+      [](double x) { return std::nearbyint(x); }, 0. },
+    { "abs", [](const V& x) { return abs(x); },
+      [](double x) { return std::fabs(x); }, 0. },
+    { "precise::sin", SVL::precise::sin<V>,
+      [](double x) { return std::sin(x); }, 0.5001 },
+    { "precise::cos", SVL::precise::cos<V>,
+      [](double x) { return std::cos(x); }, 0.5001 },
+    { "precise::exp", SVL::precise::exp<V>,
+      [](double x) { return std::exp(x); }, 0.5001 },
+    { "precise::log", SVL::precise::log<V>,
+      [](double x) { return std::log(x); }, 0.5001 },
+    { "precise::atan", SVL::precise::atan<V>,
+      [](double x) { return std::atan(x); }, 0.5001 },
+    { "fast::sin", SVL::fast::sin<V>,
+      [](double x) { return std::sin(x); }, 3. },
+    { "fast::cos", SVL::fast::cos<V>,
+      [](double x) { return std::cos(x); }, 3. },
+    { "fast::exp", SVL::fast::exp<V>,
+      [](double x) { return std::exp(x); }, 3. },
+    { "fast::log", SVL::fast::log<V>,
+      [](double x) { return std::log(x); }, 3. },
+    { "fast::atan", SVL::fast::atan<V>,
+      [](double x) { return std::atan(x); }, 3. },
+    { "fast::tanh", SVL::fast::tanh<V>,
+      [](double x) { return std::tanh(x); }, 3. },
+    { "fast::sinh", SVL::fast::sinh<V>,
+      [](double x) { return std::sinh(x); }, 3. },
+    { "fast::cosh", SVL::fast::cosh<V>,
+      [](double x) { return std::cosh(x); }, 3. },
+    { "fast::erf", SVL::fast::erf<V>,
+      [](double x) { return std::erf(x); }, 3. },
+    { "fast::erfc", SVL::fast::erfc<V>,
+      [](double x) { return std::erfc(x); }, 7. },
+    { "fast::cbrt", SVL::fast::cbrt<V>,
+      [](double x) { return std::cbrt(x); }, 1. },
+  };
+  for (const Unary<V>& c : cases) {
+    ErrorStats stats = sweep_floats_parallel<V>(0, u64(1) << 32, stride, c.f,
+                                                c.ref, [](float) { return true; },
+                                                ulp_error);
+    report(c.name, stats);
+    CAPTURE(c.name);
+    CAPTURE(stats.worst_input);
+    CHECK(stats.max <= c.bound);
+    check_special_values<V>(c.name, c.f, c.ref);
+  }
+
+  // lgamma is measured in ULP for x > 0 only. Its zeros at negative x are
+  // not exact, so there the error is relative to max(1, |lgamma(x)|), for
+  // normal inputs as in test/policy.cpp
+  auto ref_lgamma = [](double x) { return std::lgamma(x); };
+  const u64 negative = u64(1) << 31;
+  ErrorStats stats = sweep_floats_parallel<V>(0, negative, stride, SVL::fast::lgamma<V>,
+                                              ref_lgamma, [](float) { return true; },
+                                              ulp_error);
+  report("fast::lgamma x > 0", stats);
+  CAPTURE(stats.worst_input);
+  CHECK(stats.max <= 5.);
+  stats = sweep_floats_parallel<V>(negative, u64(1) << 32, stride, SVL::fast::lgamma<V>,
+                                   ref_lgamma,
+                                   [](float x) { return !(std::fabs(x) < 1.17549435e-38f); },
+                                   lgamma_error);
+  MESSAGE("fast::lgamma x < 0: max error 2^" << std::log2(stats.max) << " at "
+          << stats.worst_input);
+  CHECK(stats.max <= std::exp2(-18.));
+  check_special_values<V>("fast::lgamma", SVL::fast::lgamma<V>, ref_lgamma);
+}
+
+TEST_CASE_TEMPLATE("Binary float functions", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector8f, SVL::avx2::Vector8f) {
+  const Binary<V> cases[] = {
+    { "atan2", [](const V& y, const V& x) { return atan2(y, x); },
+      [](double y, double x) { return std::atan2(y, x); }, 4. },
+    { "divide", [](const V& a, const V& b) { return a / b; },
+      [](double a, double b) { return a / b; }, 0.5 },
+    { "fast::hypot", SVL::fast::hypot<V>,
+      [](double x, double y) { return std::hypot(x, y); }, 1.5 },
+  };
+  u64 seed = 1;
+  for (const Binary<V>& c : cases) {
+    ErrorStats stats = sample_pairs_parallel<V>(n_pairs, seed++, c.f, c.ref,
+                                                [](float, float) { return true; },
+                                                ulp_error);
+    report(c.name, stats);
+    CAPTURE(c.name);
+    CAPTURE(stats.worst_input);
+    CHECK(stats.max <= c.bound);
+    // Every combination of special values
+    for (float y : special_values) {
+      CAPTURE(y);
+      check_special_values<V>(c.name, [&](const V& x) { return c.f(V(y), x); },
+                              [&](double x) { return c.ref(double(y), x); });
+    }
+  }
+}
+TEST_SUITE_END();
@@ -0,0 +1,78 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+using namespace SVL::expr;
+
+static const i64 max_n = 41;
+
+//! Evaluate make_expr(n) with V for every length up to max_n, so each ends
+//! with a different partial vector, and compare against ref(i) element-wise
+template <typename V, typename E, typename R>
+static void check_expression(E make_expr, R ref, i64 out_n = -1) {
+  flt out[max_n + 1];
+  for (i64 n = 0; n <= max_n; ++n) {
+    CAPTURE(n);
+    out[n] = -1.f;
+    evaluate<V>(out, out_n < 0 ? n : out_n, make_expr(n));
+    SVL_FOR_RANGE(n) CHECK(out[i] == doctest::Approx(ref(i)).epsilon(1e-6));
+    // Nothing written past the end
+    CHECK(out[n] == -1.f);
+  }
+}
+
+TEST_SUITE_BEGIN("Expressions");
+TEST_CASE_TEMPLATE("Fused array expressions", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector4f, SVL::sse::Vector8f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  flt a[max_n], b[max_n], c[max_n];
+  SVL_FOR_RANGE(max_n) {
+    a[i] = 0.25f * flt(i) - 3.f;
+    b[i] = 1.f + 0.5f * flt(i);
+    c[i] = flt(max_n - i);
+  }
+
+  SUBCASE("Arithmetic with scalars") {
+    check_expression<V>(
+      [&](i64 n) { return span(a, n) * span(b, n) + 2.f * span(c, n) - 1.f; },
+      [&](i64 i) { return a[i] * b[i] + 2.f * c[i] - 1.f; });
+  }
+  SUBCASE("Division and negation") {
+    check_expression<V>([&](i64 n) { return -span(a, n) / span(b, n); },
+                        [&](i64 i) { return -a[i] / b[i]; });
+  }
+  SUBCASE("Math functions") {
+    check_expression<V>(
+      [&](i64 n) {
+        return max(abs(span(a, n)), 0.5f) + sqrt(span(b, n))
+               - atan2(span(a, n), span(c, n));
+      },
+      [&](i64 i) {
+        return SVL_MAX(std::fabs(a[i]), 0.5f) + std::sqrt(b[i])
+               - std::atan2(a[i], c[i]);
+      });
+  }
+  SUBCASE("Fused multiply add") {
+    check_expression<V>([&](i64 n) { return fma(span(a, n), span(b, n), span(c, n)); },
+                        [&](i64 i) { return std::fma(a[i], b[i], c[i]); });
+  }
+  SUBCASE("Mapped policy function") {
+    check_expression<V>(
+      [&](i64 n) {
+        return map([](const auto& v) { return SVL::precise::exp(v); },
+                   span(a, n) * 0.5f);
+      },
+      [&](i64 i) { return flt(std::exp(double(a[i] * 0.5f))); });
+  }
+  SUBCASE("Shortest span limits the length") {
+    check_expression<V>([&](i64 n) { return span(a, n) + span(b, max_n); },
+                        [&](i64 i) { return a[i] + b[i]; }, max_n);
+  }
+}
+
+TEST_CASE("Evaluating in place") {
+  flt a[19];
+  SVL_FOR_RANGE(19) a[i] = flt(i);
+  evaluate(a, 19, span(a, 19) * span(a, 19) + 1.f);
+  SVL_FOR_RANGE(19) CHECK(a[i] == flt(i * i + 1));
+}
+TEST_SUITE_END();
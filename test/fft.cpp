@@ -0,0 +1,126 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using cdbl = std::complex<dbl>;
+
+static std::vector<flt> random_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_real_distribution<flt> dis(-1.f, 1.f);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = dis(gen);
+  return v;
+}
+
+//! Naive DFT of re + i im in double precision, with exponent sign * 2 pi i j k / n
+static std::vector<cdbl> dft(const std::vector<flt>& re, const std::vector<flt>& im, dbl sign) {
+  const i64 n = re.size();
+  std::vector<cdbl> out(n);
+  for (i64 k = 0; k < n; ++k) {
+    cdbl sum = 0.;
+    for (i64 j = 0; j < n; ++j) {
+      const dbl angle = sign * 6.283185307179586477 * dbl(j * k % n) / dbl(n);
+      sum += cdbl(re[j], im[j]) * cdbl(std::cos(angle), std::sin(angle));
+    }
+    out[k] = sum;
+  }
+  return out;
+}
+
+//! Largest error in re + i im against expected, relative to the root mean
+//! square of expected
+static dbl error(const flt* re, const flt* im, const std::vector<cdbl>& expected) {
+  dbl worst = 0., rms = 0.;
+  for (i64 k = 0; k < i64(expected.size()); ++k) {
+    worst = SVL_MAX(worst, std::abs(cdbl(re[k], im[k]) - expected[k]));
+    rms += std::norm(expected[k]);
+  }
+  return worst / std::sqrt(SVL_MAX(rms / dbl(expected.size()), 1e-300));
+}
+
+//! Float rounding grows with log2(n) through the passes
+static dbl tolerance(i64 n) { return 0x1p-21 * (2. + std::log2(dbl(n))); }
+
+TEST_SUITE_BEGIN("FFT");
+TEST_CASE_TEMPLATE("complex transforms against a naive DFT", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector4f, SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 n = 1; n <= 2048; n *= 2) {
+    CAPTURE(n);
+    std::vector<flt> re = random_input(n, 1), im = random_input(n, 2);
+    const SVL::FFTPlan<V>& plan = SVL::fft_plan<V>(n);
+    CHECK(plan.size() == n);
+    CHECK(&plan == &SVL::fft_plan<V>(n));
+
+    std::vector<flt> fre = re, fim = im;
+    plan.forward(fre.data(), fim.data());
+    CHECK(error(fre.data(), fim.data(), dft(re, im, -1.)) <= tolerance(n));
+
+    std::vector<flt> ire = re, iim = im;
+    plan.inverse(ire.data(), iim.data());
+    CHECK(error(ire.data(), iim.data(), dft(re, im, 1.)) <= tolerance(n));
+
+    // The inverse of the forward transform is n times the input
+    plan.inverse(fre.data(), fim.data());
+    std::vector<cdbl> scaled(n);
+    SVL_FOR_RANGE(n) scaled[i] = cdbl(re[i], im[i]) * dbl(n);
+    CHECK(error(fre.data(), fim.data(), scaled) <= tolerance(n));
+  }
+}
+
+TEST_CASE_TEMPLATE("real transforms", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 n = 2; n <= 4096; n *= 2) {
+    CAPTURE(n);
+    std::vector<flt> x = random_input(n, 3);
+    const SVL::RealFFTPlan<V>& plan = SVL::real_fft_plan<V>(n);
+    CHECK(&plan == &SVL::real_fft_plan<V>(n));
+
+    std::vector<flt> re(n / 2 + 1, -1.f), im(n / 2 + 1, -1.f);
+    plan.forward(x.data(), re.data(), im.data());
+    std::vector<cdbl> expected = dft(x, std::vector<flt>(n, 0.f), -1.);
+    expected.resize(n / 2 + 1);
+    CHECK(error(re.data(), im.data(), expected) <= tolerance(n));
+    CHECK(im[0] == 0.f);
+    CHECK(im[n / 2] == 0.f);
+
+    std::vector<flt> back(n, -1.f);
+    plan.inverse(re.data(), im.data(), back.data());
+    std::vector<cdbl> scaled(n);
+    std::vector<flt> zeros(n, 0.f);
+    SVL_FOR_RANGE(n) scaled[i] = dbl(x[i]) * dbl(n);
+    CHECK(error(back.data(), zeros.data(), scaled) <= tolerance(n));
+  }
+}
+
+TEST_CASE_TEMPLATE("batched rows", V, SVL::sse::Vector4f, SVL::avx2::Vector8f) {
+  const i64 n = 256, rows = 37, stride = n + 5;
+  std::vector<flt> re = random_input(rows * stride, 4), im = random_input(rows * stride, 5);
+  for (i64 threads : { 1, 4 }) {
+    CAPTURE(threads);
+    std::vector<flt> fre = re, fim = im;
+    SVL::fft_plan<V>(n).forward(rows, fre.data(), fim.data(), stride, threads);
+    for (i64 r = 0; r < rows; ++r) {
+      CAPTURE(r);
+      std::vector<flt> row_re(re.begin() + r * stride, re.begin() + r * stride + n);
+      std::vector<flt> row_im(im.begin() + r * stride, im.begin() + r * stride + n);
+      CHECK(error(fre.data() + r * stride, fim.data() + r * stride, dft(row_re, row_im, -1.)) <=
+            tolerance(n));
+      // The padding between rows is untouched
+      for (i64 i = r * stride + n; i < (r + 1) * stride; ++i) {
+        CHECK(fre[i] == re[i]);
+        CHECK(fim[i] == im[i]);
+      }
+    }
+    SVL::fft_plan<V>(n).inverse(rows, fre.data(), fim.data(), stride, threads);
+    for (i64 r = 0; r < rows; ++r) {
+      std::vector<cdbl> scaled(n);
+      SVL_FOR_RANGE(n) scaled[i] = cdbl(re[r * stride + i], im[r * stride + i]) * dbl(n);
+      CHECK(error(fre.data() + r * stride, fim.data() + r * stride, scaled) <= tolerance(n));
+    }
+  }
+}
+TEST_SUITE_END();
@@ -3,6 +3,8 @@
 #include <string>
 
 #include <random>
+#include <utility>
+#include <type_traits>
 
 // unions for the types to check
 union F4Scalar {
@@ -1231,3 +1233,279 @@ TEST_CASE_TEMPLATE("Vecf mathematics", T, F4Scalar, F4SSE, F4AVX2,
   
 }
 
+
+TEST_CASE_TEMPLATE("Vecf fused multiply add", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  PopulateVs(vs);
+  
+  V a(vs), b(vs + 16), c(vs + 32);
+  V r1 = fma(a, b, c), r2 = fnma(a, b, c);
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(i);
+    CHECK(r1[i] == doctest::Approx(vs[i] * vs[i + 16] + vs[i + 32]));
+    CHECK(r2[i] == doctest::Approx(vs[i + 32] - vs[i] * vs[i + 16]));
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecf reciprocal approximations", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  PopulateVs(vs);
+  
+  // Spread the values over a wide range of exponents
+  float in[16];
+  SVL_FOR_RANGE(16) in[i] = std::ldexp(vs[i], int(i * 5) - 40);
+  V x(in);
+  V r[6] = { rcp(x), rcp_nr(x), rcp_nr2(x), rsqrt(x), rsqrt_nr(x), rsqrt_nr2(x) };
+  // Documented bounds on the relative error
+  const double bounds[6] = { 1.5 * std::exp2(-12.), std::exp2(-22.),
+                             std::exp2(-23.), 1.5 * std::exp2(-12.),
+                             std::exp2(-21.), std::exp2(-22.5) };
+  const char* names[6] = { "rcp", "rcp_nr", "rcp_nr2",
+                           "rsqrt", "rsqrt_nr", "rsqrt_nr2" };
+  SVL_FOR_RANGE(V::step) {
+    double expected_rcp = 1. / double(in[i]);
+    double expected_rsqrt = 1. / std::sqrt(double(in[i]));
+    for (int j = 0; j < 6; ++j) {
+      double expected = j < 3 ? expected_rcp : expected_rsqrt;
+      CAPTURE(names[j] << " element " << i);
+      CHECK(std::fabs(r[j][i] - expected) / expected <= bounds[j]);
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecf compile time constants", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  
+  V half = SVL_CONSTANT(V, 0.5f);
+  V one = SVL::constant<V, 0x3F800000u>();
+  V sign = SVL::constant<V, 0x80000000u>();
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(i);
+    CHECK(half[i] == 0.5f);
+    CHECK(one[i] == 1.f);
+    CHECK(sign[i] == 0.f);
+    CHECK(std::signbit(sign[i]));
+  }
+  if constexpr (V::step == 4) {
+    V seq = SVL::constant<V, 0x3F800000u, 0x40000000u, 0x40400000u, 0x40800000u>();
+    SVL_FOR_RANGE(V::step) CHECK(seq[i] == float(i + 1));
+  }
+  // Shorter patterns repeat
+  V alternating = SVL::constant<V, SVL::float_bits(1.f), SVL::float_bits(-1.f)>();
+  SVL_FOR_RANGE(V::step) CHECK(alternating[i] == ((i & 1) ? -1.f : 1.f));
+  CHECK(SVL::float_bits(-2.f) == 0xC0000000u);
+  CHECK(reinterpret_cast<uintptr_t>(
+          &SVL::constant_table<V, 0x3F800000u>::table) % 64 == 0);
+  // The tables are read only and usable in constant expressions
+  static_assert(std::is_const_v<decltype(SVL::constant_table<V, 0x3F800000u>::table)>);
+  static_assert(SVL::constant_table<V, 0x3F800000u>::table.values[V::step - 1] == 0x3F800000u);
+}
+
+//! Bitwise equal, or both NaN
+static bool same_float(float a, float b) {
+  if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+  return SVL::float_bits(a) == SVL::float_bits(b);
+}
+
+// Zeros, denormals, normals either side of whole numbers, halfway cases,
+// extremes, infinities and NaN
+const float special_values[16] = {
+  0.f, -0.f, 1.5f, -2.5f, 7.25f, -1e-40f, INFINITY, -INFINITY,
+  NAN, 1e30f, -3e-39f, 0.5f, 2.5f, -100.75f, 3.4028235e38f, 1.1754944e-38f };
+
+TEST_CASE_TEMPLATE("Vecf rounding and remainders", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  
+  for (int offset = 0; offset < 16; offset += V::step) {
+    V x(special_values + offset);
+    V t = trunc(x), f = fract(x), s = sign(x);
+    SVL_FOR_RANGE(V::step) {
+      float v = special_values[offset + i];
+      CAPTURE(v);
+      CHECK(same_float(t[i], std::trunc(v)));
+      float expected_fract = !std::isfinite(v) ? NAN : std::fmin(v - std::floor(v), 0x1.fffffep-1f);
+      CHECK(same_float(f[i], expected_fract));
+      float expected_sign = (v == 0.f || std::isnan(v)) ? v : std::copysign(1.f, v);
+      CHECK(same_float(s[i], expected_sign));
+    }
+  }
+  // A tiny negative value would round to 1 without the clamp
+  CHECK(fract(V(-1e-10f))[0] < 1.f);
+  
+  // Every pairing of the special values, exactly as the C library
+  for (int offset = 0; offset < 16; offset += V::step) {
+    for (int shift = 0; shift < 16; ++shift) {
+      float ys[16];
+      SVL_FOR_RANGE(16) ys[i] = special_values[(i + shift) % 16];
+      V x(special_values + offset), y(ys + offset);
+      V c = copysign(x, y), m = fmod(x, y), r = remainder(x, y);
+      SVL_FOR_RANGE(V::step) {
+        float a = special_values[offset + i], b = ys[offset + i];
+        CAPTURE(a);
+        CAPTURE(b);
+        CHECK(same_float(c[i], std::copysign(a, b)));
+        CHECK(same_float(m[i], std::fmod(a, b)));
+        CHECK(same_float(r[i], std::remainder(a, b)));
+      }
+    }
+  }
+  
+  // Random values over the whole exponent range, including quotients too
+  // large for a single reduction step
+  std::mt19937 gen(44);
+  std::uniform_real_distribution<float> mant(-1.f, 1.f);
+  std::uniform_int_distribution<int> ex(-149, 127);
+  for (int trial = 0; trial < 2000; ++trial) {
+    float xs[16], ys[16];
+    SVL_FOR_RANGE(16) {
+      xs[i] = std::ldexp(mant(gen), ex(gen));
+      ys[i] = std::ldexp(mant(gen), ex(gen) / (trial % 3 + 1));
+    }
+    V x(xs), y(ys);
+    V m = fmod(x, y), r = remainder(x, y);
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(xs[i]);
+      CAPTURE(ys[i]);
+      CHECK(same_float(m[i], std::fmod(xs[i], ys[i])));
+      CHECK(same_float(r[i], std::remainder(xs[i], ys[i])));
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecf exponent split", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  
+  for (int offset = 0; offset < 16; offset += V::step) {
+    V x(special_values + offset), e;
+    V m = frexp(x, e);
+    SVL_FOR_RANGE(V::step) {
+      float v = special_values[offset + i];
+      CAPTURE(v);
+      int expected_e = 0;
+      float expected_m = std::frexp(v, &expected_e);
+      CHECK(same_float(m[i], expected_m));
+      if (std::isfinite(v)) CHECK(e[i] == float(expected_e));
+      else CHECK(e[i] == 0.f);
+    }
+    // Recombining gives back x
+    V back = ldexp(m, e);
+    SVL_FOR_RANGE(V::step) CHECK(same_float(back[i], special_values[offset + i]));
+  }
+  
+  // Scales that overflow, underflow into denormals or need more than one
+  // step of pow2n
+  const float scales[16] = { 0.f, 1.f, -1.f, 127.f, 128.f, -126.f, -127.f, -149.f,
+                             -150.f, 200.f, -200.f, 254.f, -260.f, 300.f, -300.f, 24.f };
+  const float values[16] = { 1.f, -1.5f, 3e-39f, 1.f, 1.f, 1.f, 1.f, 1.f,
+                             1.f, 1e-20f, 1e20f, 1e-38f, 2e38f, 1e-45f, 0.f, -1e-45f };
+  for (int offset = 0; offset < 16; offset += V::step) {
+    V r = ldexp(V(values + offset), V(scales + offset));
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(values[offset + i]);
+      CAPTURE(scales[offset + i]);
+      CHECK(same_float(r[i], std::ldexp(values[offset + i], int(scales[offset + i]))));
+    }
+  }
+
+  // exponent and fraction read the bit fields directly, the same in every
+  // namespace, so zeros and denormals give -127 and infinities and NaNs 128
+  for (int offset = 0; offset < 16; offset += V::step) {
+    V x(special_values + offset);
+    V e = exponent(x), m = fraction(x);
+    SVL_FOR_RANGE(V::step) {
+      float v = special_values[offset + i];
+      CAPTURE(v);
+      if (!std::isfinite(v)) CHECK(e[i] == 128.f);
+      else if (std::fabs(v) < 1.17549435e-38f) CHECK(e[i] == -127.f);
+      else {
+        CHECK(e[i] == float(std::ilogb(v)));
+        CHECK(m[i] == std::ldexp(std::fabs(v), -std::ilogb(v)));
+      }
+      if (v == 0.f || std::isinf(v)) CHECK(m[i] == 1.f);
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecf classification", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  
+  for (int offset = 0; offset < 16; offset += V::step) {
+    V x(special_values + offset);
+    auto nan = isnan(x), inf = isinf(x), finite = isfinite(x), normal = isnormal(x);
+    SVL_FOR_RANGE(V::step) {
+      float v = special_values[offset + i];
+      CAPTURE(v);
+      CHECK(nan[i] == std::isnan(v));
+      CHECK(inf[i] == std::isinf(v));
+      CHECK(finite[i] == std::isfinite(v));
+      CHECK(normal[i] == std::isnormal(v));
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecf complex pairs", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  
+  float a[32], b[32], c[32];
+  SVL_FOR_RANGE(32) {
+    a[i] = float(i + 1);
+    b[i] = float(100 + 3 * i);
+    c[i] = float(i % 5) - 2.f;
+  }
+  V x(a), y(b), z(c);
+  V even_dup = dup_even(x), odd_dup = dup_odd(x), swapped = swap_pairs(x);
+  V fms = fmaddsub(x, y, z);
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(i);
+    CHECK(even_dup[i] == a[i & ~1]);
+    CHECK(odd_dup[i] == a[i | 1]);
+    CHECK(swapped[i] == a[i ^ 1]);
+    CHECK(fms[i] == a[i] * b[i] + ((i & 1) ? c[i] : -c[i]));
+  }
+  
+  // Interleaving puts x and y in alternate elements, and deinterleaving
+  // takes them back out
+  V lo, hi, even, odd;
+  interleave(x, y, lo, hi);
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(i);
+    const i64 j = i / 2;
+    CHECK(lo[i] == ((i & 1) ? b[j] : a[j]));
+    CHECK(hi[i] == ((i & 1) ? b[j + V::step / 2] : a[j + V::step / 2]));
+  }
+  deinterleave(lo, hi, even, odd);
+  SVL_FOR_RANGE(V::step) {
+    CHECK(even[i] == a[i]);
+    CHECK(odd[i] == b[i]);
+  }
+}
+
+//! Check align<S> of the vectors at a and a + step against a, for each S
+template <typename V, int... S>
+static void check_windows(const float* a, std::integer_sequence<int, S...>) {
+  const V x(a), y(a + V::step);
+  auto check = [&](auto s) {
+    constexpr int shift = decltype(s)::value;
+    CAPTURE(shift);
+    const V w = V::template align<shift>(x, y);
+    SVL_FOR_RANGE(V::step) CHECK(w[i] == a[shift + i]);
+  };
+  (check(std::integral_constant<int, S>()), ...);
+}
+
+TEST_CASE_TEMPLATE("Vecf sliding windows", T, F4Scalar, F4SSE, F4AVX2,
+                   F8Scalar, F8SSE, F8AVX2, F16Scalar, F16SSE, F16AVX2) {
+  using V = typename T::vec_t;
+  
+  float a[32];
+  SVL_FOR_RANGE(32) a[i] = float(i + 1);
+  // Every window from all of the first vector to all of the second
+  check_windows<V>(a, std::make_integer_sequence<int, V::step + 1>());
+}
@@ -0,0 +1,107 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+// Small integers, so every product and sum is exact
+static std::vector<flt> gemm_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_int_distribution<int> dis(-4, 4);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = flt(dis(gen));
+  return v;
+}
+
+// c = alpha * a * b + beta * c the slow way, with the matrices padded out to
+// the row strides
+static void gemm_reference(i64 m, i64 n, i64 k, flt alpha, const std::vector<flt>& a, i64 lda,
+                           const std::vector<flt>& b, i64 ldb, flt beta, std::vector<flt>& c,
+                           i64 ldc) {
+  for (i64 i = 0; i < m; ++i)
+    for (i64 j = 0; j < n; ++j) {
+      flt sum = 0.f;
+      for (i64 p = 0; p < k; ++p) sum += a[i * lda + p] * b[p * ldb + j];
+      c[i * ldc + j] = alpha * sum + (beta != 0.f ? beta * c[i * ldc + j] : 0.f);
+    }
+}
+
+TEST_SUITE_BEGIN("Gemm");
+TEST_CASE_TEMPLATE("gemm", V, SVL::scalar::Vector8f, SVL::sse::Vector4f, SVL::sse::Vector8f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  struct shape { i64 m, n, k; };
+  // Partial micro-kernel blocks, more than one block of rows (mc) and depth
+  // (kc), and no depth at all
+  for (shape s : { shape{ 1, 1, 1 }, shape{ 7, 13, 5 }, shape{ 6, 32, 8 },
+                   shape{ 50, 37, 300 }, shape{ 150, 20, 3 }, shape{ 4, 5, 0 } }) {
+    for (flt beta : { 0.f, -3.f }) {
+      CAPTURE(s.m);
+      CAPTURE(s.n);
+      CAPTURE(s.k);
+      CAPTURE(beta);
+      const i64 lda = s.k + 3, ldb = s.n + 1, ldc = s.n + 2;
+      std::vector<flt> a = gemm_input(s.m * lda, 1), b = gemm_input(s.k * ldb, 2);
+      std::vector<flt> c = gemm_input(s.m * ldc, 3);
+      // With beta 0 c isn't read
+      if (beta == 0.f) std::fill(c.begin(), c.end(), std::numeric_limits<flt>::quiet_NaN());
+      std::vector<flt> ref = c;
+      gemm_reference(s.m, s.n, s.k, 2.f, a, lda, b, ldb, beta, ref, ldc);
+      SVL::gemm<V>(s.m, s.n, s.k, 2.f, a.data(), lda, b.data(), ldb, beta, c.data(), ldc);
+      for (i64 i = 0; i < s.m; ++i)
+        for (i64 j = 0; j < ldc; ++j) {
+          CAPTURE(i);
+          CAPTURE(j);
+          // Padding past n is left alone
+          if (j < s.n) CHECK(c[i * ldc + j] == ref[i * ldc + j]);
+          else CHECK(std::isnan(c[i * ldc + j]) == (beta == 0.f));
+        }
+    }
+  }
+}
+
+TEST_CASE("gemm with more than one panel of columns") {
+  const i64 m = 3, n = SVL_GEMM_NC + 100, k = 4;
+  std::vector<flt> a = gemm_input(m * k, 4), b = gemm_input(k * n, 5), c = gemm_input(m * n, 6);
+  std::vector<flt> ref = c;
+  gemm_reference(m, n, k, 1.f, a, k, b, n, 1.f, ref, n);
+  SVL::gemm(m, n, k, 1.f, a.data(), k, b.data(), n, 1.f, c.data(), n);
+  CHECK(c == ref);
+}
+
+TEST_CASE("parallel gemm") {
+  struct shape { i64 m, n, k; };
+  // Split by rows, and by columns
+  for (shape s : { shape{ 301, 64, 90 }, shape{ 20, 517, 130 } }) {
+    std::vector<flt> a = gemm_input(s.m * s.k, 7), b = gemm_input(s.k * s.n, 8);
+    std::vector<flt> ref(s.m * s.n);
+    gemm_reference(s.m, s.n, s.k, 1.f, a, s.k, b, s.n, 0.f, ref, s.n);
+    for (i64 threads : { 1, 3, 8 }) {
+      CAPTURE(s.m);
+      CAPTURE(threads);
+      std::vector<flt> c(s.m * s.n, 1.f);
+      SVL::parallel_gemm(s.m, s.n, s.k, 1.f, a.data(), s.k, b.data(), s.n, 0.f, c.data(), s.n,
+                         threads);
+      CHECK(c == ref);
+    }
+  }
+}
+
+template <i64 M, i64 N, i64 K, typename V>
+static void check_matmul() {
+  std::vector<flt> a = gemm_input(M * K, 9), b = gemm_input(K * N, 10), c(M * N, 1.f);
+  std::vector<flt> ref(M * N);
+  gemm_reference(M, N, K, 1.f, a, K, b, N, 0.f, ref, N);
+  SVL::matmul<M, N, K, V>(c.data(), a.data(), b.data());
+  CHECK(c == ref);
+}
+
+TEST_CASE_TEMPLATE("matmul", V, SVL::scalar::Vector4f, SVL::sse::Vector4f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  check_matmul<1, 1, 1, V>();
+  check_matmul<3, 3, 3, V>();
+  check_matmul<4, 4, 4, V>();
+  check_matmul<5, 11, 7, V>();
+  check_matmul<8, 16, 8, V>();
+}
+TEST_SUITE_END();
@@ -0,0 +1,101 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Multiples of 1/8 from -12 to 12 with some NaNs and infinities, so that bin
+// positions in [-10, 10] are exact
+static std::vector<flt> histogram_input(i64 n) {
+  std::mt19937 gen{ u32(n) };
+  std::uniform_int_distribution<int> dis(-96, 96);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = flt(dis(gen)) / 8.f;
+  for (i64 i = 5; i < n; i += 37) v[i] = std::numeric_limits<flt>::quiet_NaN();
+  for (i64 i = 11; i < n; i += 53) v[i] = (i & 1 ? -1.f : 1.f) * std::numeric_limits<flt>::infinity();
+  return v;
+}
+
+// Counts for the bins between edges, the last holding its high edge
+static std::vector<u64> histogram_reference(const std::vector<flt>& in, const std::vector<flt>& edges) {
+  std::vector<u64> counts(edges.size() - 1, 0);
+  for (flt x : in) {
+    if (!(x >= edges.front() && x <= edges.back())) continue;
+    i64 bin = std::upper_bound(edges.begin(), edges.end(), x) - edges.begin() - 1;
+    ++counts[SVL_MIN(bin, i64(counts.size()) - 1)];
+  }
+  return counts;
+}
+
+TEST_SUITE_BEGIN("Histogram");
+TEST_CASE_TEMPLATE("equal width bins", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::sse::Vector16f, SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 bins : { 1, 7, 40 }) {
+    std::vector<flt> edges(bins + 1);
+    SVL_FOR_RANGE(bins + 1) edges[i] = -10.f + 20.f * flt(i) / flt(bins);
+    for (i64 n : { 0, 3, 16, 17, 1000 }) {
+      CAPTURE(bins);
+      CAPTURE(n);
+      std::vector<flt> in = histogram_input(n);
+      std::vector<u64> counts(bins + 1, 77);
+      SVL::histogram<V>(in.data(), n, -10.f, 10.f, bins, counts.data());
+      CHECK(counts[bins] == 77);
+      counts.pop_back();
+      CHECK(counts == histogram_reference(in, edges));
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("bins between edges", V, SVL::scalar::Vector4f, SVL::sse::Vector8f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  std::mt19937 gen{ 42 };
+  std::uniform_real_distribution<flt> dis(-11.f, 11.f);
+  // Few edges are compared in registers, many searched for
+  for (i64 n_edges : { 2, 9, 64, 65, 300 }) {
+    std::vector<flt> edges(n_edges);
+    for (flt& e : edges) e = dis(gen);
+    std::sort(edges.begin(), edges.end());
+    for (i64 n : { 5, 1003 }) {
+      CAPTURE(n_edges);
+      CAPTURE(n);
+      std::vector<flt> in = histogram_input(n);
+      // Some values exactly on edges
+      SVL_FOR_RANGE(SVL_MIN(n, n_edges)) in[(i * 7) % n] = edges[i];
+      std::vector<u64> counts(n_edges - 1);
+      SVL::histogram<V>(in.data(), n, edges.data(), n_edges, counts.data());
+      CHECK(counts == histogram_reference(in, edges));
+    }
+  }
+}
+
+TEST_CASE("parallel histogram") {
+  const i64 n = 300001;
+  std::vector<flt> in = histogram_input(n);
+  std::vector<flt> edges = { -10.f, -3.f, -0.5f, 0.f, 2.f, 9.5f, 10.f };
+  std::vector<flt> even(21);
+  SVL_FOR_RANGE(21) even[i] = -10.f + flt(i);
+  for (i64 threads : { 1, 3, 8 }) {
+    CAPTURE(threads);
+    std::vector<u64> counts(20);
+    SVL::parallel_histogram(in.data(), n, -10.f, 10.f, 20, counts.data(), threads);
+    CHECK(counts == histogram_reference(in, even));
+    counts.resize(edges.size() - 1);
+    SVL::parallel_histogram(in.data(), n, edges.data(), i64(edges.size()), counts.data(), threads);
+    CHECK(counts == histogram_reference(in, edges));
+  }
+}
+
+TEST_CASE("more equal width bins than floats hold exactly") {
+  // bins - 1 rounds up to 2^25 + 8 as a float, the top of the range must
+  // still land in the last bin rather than past the slots
+  const i64 bins = (i64(1) << 25) + 7;
+  SVL::detail::uniform_bins b(0.f, 1.f, bins);
+  CHECK(!b.vectorised);
+  CHECK(b.slot(0.f) == 1);
+  CHECK(b.slot(1.f) == bins);
+  CHECK(b.slot(1.5f) == bins + 1);
+  CHECK(b.slot(-0.5f) == 0);
+}
+TEST_SUITE_END();
@@ -0,0 +1,118 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <limits>
+#include <random>
+
+// Fills a and b with random values, including the extremes and values that
+// only differ in their high or low 32 bits
+template <typename V>
+static void random_longs(typename V::scalar_t* a, typename V::scalar_t* b) {
+  using T = typename V::scalar_t;
+  std::mt19937_64 gen(V::step);
+  SVL_FOR_RANGE(V::step) {
+    a[i] = T(gen());
+    b[i] = T(gen());
+  }
+  a[0] = std::numeric_limits<T>::max(); b[0] = std::numeric_limits<T>::min();
+  a[1] = T(0x00000001FFFFFFFF); b[1] = T(0x0000000200000000);
+  if constexpr (V::step > 2) {
+    a[2] = T(-1); b[2] = T(0xFFFFFFFF);
+    a[3] = b[3];
+  }
+}
+
+template <typename V>
+static void check_long_arithmetic() {
+  using T = typename V::scalar_t;
+  T a[V::step], b[V::step];
+  random_longs<V>(a, b);
+  V va(a), vb(b);
+  const T t = T(-1);
+
+  struct Op { const char* name; V result; T (*ref)(T, T); };
+  const Op ops[] = {
+    { "+", va + vb, [](T x, T y) { return T(u64(x) + u64(y)); } },
+    { "-", va - vb, [](T x, T y) { return T(u64(x) - u64(y)); } },
+    { "*", va * vb, [](T x, T y) { return T(u64(x) * u64(y)); } },
+    { "min", min(va, vb), [](T x, T y) { return SVL_MIN(x, y); } },
+    { "max", max(va, vb), [](T x, T y) { return SVL_MAX(x, y); } },
+    { "==", va == vb, [](T x, T y) { return x == y ? T(-1) : T(0); } },
+    { "!=", va != vb, [](T x, T y) { return x != y ? T(-1) : T(0); } },
+    { "<", va < vb, [](T x, T y) { return x < y ? T(-1) : T(0); } },
+    { "<=", va <= vb, [](T x, T y) { return x <= y ? T(-1) : T(0); } },
+    { ">", va > vb, [](T x, T y) { return x > y ? T(-1) : T(0); } },
+    { ">=", va >= vb, [](T x, T y) { return x >= y ? T(-1) : T(0); } },
+    { "&", va & vb, [](T x, T y) { return T(x & y); } },
+    { "|", va | vb, [](T x, T y) { return T(x | y); } },
+    { "^", va ^ vb, [](T x, T y) { return T(x ^ y); } },
+    { "and_not", and_not(va, vb), [](T x, T y) { return T(~x & y); } },
+    { "blend", blend(va, vb, va < vb), [](T x, T y) { return x < y ? x : y; } },
+  };
+  for (const Op& op : ops) {
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(op.name);
+      CAPTURE(i);
+      CHECK(op.result[i] == op.ref(a[i], b[i]));
+    }
+  }
+  CHECK((va == va)[0] == t);
+
+  for (i32 n : { 0, 1, 31, 32, 33, 63, 64 }) {
+    V left = va << n, right = va >> n;
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(n);
+      CAPTURE(i);
+      CHECK(left[i] == T(n < 64 ? u64(a[i]) << n : 0));
+      if (std::is_signed<T>::value) CHECK(right[i] == T(a[i] >> SVL_MIN(n, 63)));
+      else CHECK(right[i] == T(n < 64 ? u64(a[i]) >> n : 0));
+    }
+  }
+}
+
+TEST_SUITE_BEGIN("Vec64");
+TEST_CASE_TEMPLATE("Veci64 arithmetic", V, SVL::scalar::Vector2i64,
+                   SVL::scalar::Vector4i64, SVL::scalar::Vector8i64,
+                   SVL::sse::Vector2i64, SVL::sse::Vector4i64,
+                   SVL::sse::Vector8i64, SVL::avx2::Vector2i64,
+                   SVL::avx2::Vector4i64, SVL::avx2::Vector8i64) {
+  check_long_arithmetic<V>();
+  i64 a[V::step], b[V::step];
+  random_longs<V>(a, b);
+  V va(a), neg = -va, logical = shift_right_logical(va, 7);
+  SVL_FOR_RANGE(V::step) {
+    CHECK(neg[i] == i64(0 - u64(a[i])));
+    CHECK(logical[i] == i64(u64(a[i]) >> 7));
+  }
+}
+
+TEST_CASE_TEMPLATE("Vecu64 arithmetic", V, SVL::scalar::Vector2u64,
+                   SVL::scalar::Vector4u64, SVL::scalar::Vector8u64,
+                   SVL::sse::Vector2u64, SVL::sse::Vector4u64,
+                   SVL::sse::Vector8u64, SVL::avx2::Vector2u64,
+                   SVL::avx2::Vector4u64, SVL::avx2::Vector8u64) {
+  check_long_arithmetic<V>();
+}
+
+TEST_CASE_TEMPLATE("Vec64 load and store", V, SVL::scalar::Vector2i64,
+                   SVL::scalar::Vector8u64, SVL::sse::Vector2u64,
+                   SVL::sse::Vector8i64, SVL::avx2::Vector4i64,
+                   SVL::avx2::Vector8u64) {
+  using T = typename V::scalar_t;
+  T a[V::step], b[V::step], out[V::step + 1];
+  random_longs<V>(a, b);
+  for (i64 n = 0; n <= V::step; ++n) {
+    CAPTURE(n);
+    out[n] = 12345;
+    V v = V().load_partial(a, n);
+    v.store_partial(out, n);
+    SVL_FOR_RANGE(V::step) CHECK(v[i] == (i < n ? a[i] : 0));
+    SVL_FOR_RANGE(n) CHECK(out[i] == a[i]);
+    CHECK(out[n] == 12345);
+  }
+  V v(a);
+  v.assign(T(-42), V::step - 1);
+  CHECK(v[V::step - 1] == T(-42));
+  CHECK(V(T(1) << 40)[V::step / 2] == T(1) << 40);
+}
+TEST_SUITE_END();
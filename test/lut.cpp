@@ -0,0 +1,110 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+static std::vector<flt> lut_input(i64 n, flt low, flt high, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_real_distribution<flt> dis(low, high);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = dis(gen);
+  return v;
+}
+
+// Entry i of a table of n, with the clamped whole number part and fraction
+// of a position in it
+static double entry(const std::vector<flt>& t, i64 i) { return t[SVL_CLAMP(i64(0), i, i64(t.size()) - 1)]; }
+static i64 split(flt x, i64 n, double& f) {
+  double c = x != x ? 0.0 : SVL_CLAMP(0.0, double(x), double(n - 1));
+  i64 i = SVL_MIN(i64(std::floor(c)), SVL_MAX(n - 2, i64(0)));
+  f = c - double(i);
+  return i;
+}
+static double linear(const std::vector<flt>& t, flt x) {
+  double f;
+  i64 i = split(x, i64(t.size()), f);
+  return entry(t, i) + f * (entry(t, i + 1) - entry(t, i));
+}
+static double cubic(const std::vector<flt>& t, flt x) {
+  double f;
+  i64 i = split(x, i64(t.size()), f);
+  double p0 = entry(t, i - 1), p1 = entry(t, i), p2 = entry(t, i + 1), p3 = entry(t, i + 2);
+  return p1 + 0.5 * f * (p2 - p0 + f * (2 * p0 - 5 * p1 + 4 * p2 - p3 + f * (3 * (p1 - p2) + p3 - p0)));
+}
+
+TEST_SUITE_BEGIN("Lookup tables");
+TEST_CASE_TEMPLATE("gather and lookup", V, SVL::scalar::Vector4f, SVL::scalar::Vector16f,
+                   SVL::sse::Vector4f, SVL::sse::Vector8f, SVL::avx2::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  std::vector<flt> table = lut_input(100, -5.f, 5.f, 1);
+  flt index[V::step];
+  SVL_FOR_RANGE(V::step) index[i] = flt((i * 37 + 5) % 100);
+  V g = gather(table.data(), V(index));
+  SVL_FOR_RANGE(V::step) index[i] = flt((i * 5 + 3) % V::step);
+  V l = lookup(V(table.data()), V(index));
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(i);
+    CHECK(g[i] == table[(i * 37 + 5) % 100]);
+    CHECK(l[i] == table[(i * 5 + 3) % V::step]);
+  }
+}
+
+TEST_CASE_TEMPLATE("one dimensional", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  // Tables in one register, in two and gathered from memory
+  for (i64 n : { 1, 2, 5, 8, 13, 16, 17, 32, 1000 }) {
+    CAPTURE(n);
+    std::vector<flt> table = lut_input(n, -5.f, 5.f, u32(n));
+    const i64 count = 101;
+    std::vector<flt> x = lut_input(count, -2.f, flt(n + 1), 2), out(count + 1, 77.f);
+    x[3] = std::numeric_limits<flt>::quiet_NaN();
+    x[4] = flt(n - 1);
+    x[5] = 0.f;
+    SVL::lut1d_linear<V>(out.data(), x.data(), count, table.data(), n);
+    SVL_FOR_RANGE(count) {
+      CAPTURE(x[i]);
+      CHECK(out[i] == doctest::Approx(linear(table, x[i])).epsilon(1e-5));
+    }
+    CHECK(out[count] == 77.f);
+    SVL::lut1d_cubic<V>(out.data(), x.data(), count, table.data(), n);
+    SVL_FOR_RANGE(count) {
+      CAPTURE(x[i]);
+      CHECK(out[i] == doctest::Approx(cubic(table, x[i])).epsilon(1e-5));
+    }
+    // Whole positions give the entries
+    flt whole[V::step];
+    SVL_FOR_RANGE(V::step) whole[i] = flt(i % n);
+    V at = SVL::lut1d_linear(table.data(), n, V(whole));
+    SVL_FOR_RANGE(V::step) CHECK(at[i] == table[i % n]);
+  }
+}
+
+TEST_CASE_TEMPLATE("bilinear", V, SVL::scalar::Vector4f, SVL::sse::Vector8f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  struct size { i64 width, height; };
+  for (size s : { size{ 1, 1 }, size{ 3, 1 }, size{ 1, 4 }, size{ 4, 3 }, size{ 30, 20 } }) {
+    CAPTURE(s.width);
+    CAPTURE(s.height);
+    std::vector<flt> table = lut_input(s.width * s.height, -5.f, 5.f, 3);
+    const i64 count = 50;
+    std::vector<flt> x = lut_input(count, -1.f, flt(s.width), 4);
+    std::vector<flt> y = lut_input(count, -1.f, flt(s.height), 5), out(count);
+    SVL::lut2d_bilinear<V>(out.data(), x.data(), y.data(), count, table.data(), s.width,
+                           s.height);
+    SVL_FOR_RANGE(count) {
+      CAPTURE(x[i]);
+      CAPTURE(y[i]);
+      double fy;
+      i64 iy = split(y[i], s.height, fy);
+      std::vector<flt> row0(table.begin() + iy * s.width, table.begin() + (iy + 1) * s.width);
+      i64 iy1 = SVL_MIN(iy + 1, s.height - 1);
+      std::vector<flt> row1(table.begin() + iy1 * s.width, table.begin() + (iy1 + 1) * s.width);
+      double top = linear(row0, x[i]), bottom = linear(row1, x[i]);
+      CHECK(out[i] == doctest::Approx(top + fy * (bottom - top)).epsilon(1e-5));
+    }
+  }
+}
+TEST_SUITE_END();
@@ -0,0 +1,85 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Few distinct values, so there are plenty of ties
+static std::vector<flt> minmax_input(i64 n) {
+  std::mt19937 gen{ u32(n) };
+  std::uniform_int_distribution<int> dis(-50, 50);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = flt(dis(gen));
+  return v;
+}
+
+TEST_SUITE_BEGIN("Min max");
+TEST_CASE_TEMPLATE("argmin and argmax", V, SVL::scalar::Vector4f, SVL::scalar::Vector8f,
+                   SVL::sse::Vector4f, SVL::sse::Vector16f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  for (i64 n : { 1, 3, 16, 17, 1000 }) {
+    CAPTURE(n);
+    std::vector<flt> in = minmax_input(n);
+    i64 lo = std::min_element(in.begin(), in.end()) - in.begin();
+    i64 hi = std::max_element(in.begin(), in.end()) - in.begin();
+    CHECK(SVL::argmin<V>(in.data(), n) == lo);
+    CHECK(SVL::argmax<V>(in.data(), n) == hi);
+    CHECK(SVL::minmax_element<V>(in.data(), n) == std::make_pair(lo, hi));
+    CHECK(SVL::argmin<V>(in.data(), n, SVL::nan_policy::propagate) == lo);
+    CHECK(SVL::argmax<V>(in.data(), n, SVL::nan_policy::propagate) == hi);
+
+    // Extremes in the scalar tail and in the last lane
+    in[n - 1] = -1000.f;
+    CHECK(SVL::argmin<V>(in.data(), n) == n - 1);
+    in[n / 2] = 1000.f;
+    in[n - 1] = 1000.f;
+    CHECK(SVL::argmax<V>(in.data(), n) == n / 2);
+  }
+  CHECK(SVL::argmin<V>(nullptr, 0) == -1);
+  CHECK(SVL::minmax_element<V>(nullptr, 0) == std::make_pair(i64(-1), i64(-1)));
+}
+
+TEST_CASE_TEMPLATE("NaN handling", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  const flt nan = std::numeric_limits<flt>::quiet_NaN();
+  for (i64 n : { 5, 40, 103 }) {
+    CAPTURE(n);
+    std::vector<flt> in = minmax_input(n);
+    i64 lo = std::min_element(in.begin(), in.end()) - in.begin();
+    i64 hi = std::max_element(in.begin(), in.end()) - in.begin();
+    // NaNs first, in the middle and last, but never on an extreme
+    for (i64 at : { i64(0), n / 3, n - 1 })
+      if (at != lo && at != hi) in[at] = nan;
+    i64 first_nan = std::find_if(in.begin(), in.end(), [](flt x) { return x != x; }) - in.begin();
+
+    CHECK(SVL::argmin<V>(in.data(), n) == lo);
+    CHECK(SVL::argmax<V>(in.data(), n) == hi);
+    CHECK(SVL::argmin<V>(in.data(), n, SVL::nan_policy::propagate) == first_nan);
+    CHECK(SVL::minmax_element<V>(in.data(), n, SVL::nan_policy::propagate) ==
+          std::make_pair(first_nan, first_nan));
+
+    std::fill(in.begin(), in.end(), nan);
+    CHECK(SVL::minmax_element<V>(in.data(), n) == std::make_pair(i64(-1), i64(-1)));
+    CHECK(SVL::argmax<V>(in.data(), n, SVL::nan_policy::propagate) == 0);
+  }
+}
+
+TEST_CASE("parallel argmin and argmax") {
+  const i64 n = 300001;
+  std::vector<flt> in = minmax_input(n);
+  i64 lo = std::min_element(in.begin(), in.end()) - in.begin();
+  i64 hi = std::max_element(in.begin(), in.end()) - in.begin();
+  for (i64 threads : { 1, 3, 8 }) {
+    CAPTURE(threads);
+    CHECK(SVL::parallel_argmin(in.data(), n, SVL::nan_policy::ignore, threads) == lo);
+    CHECK(SVL::parallel_argmax(in.data(), n, SVL::nan_policy::ignore, threads) == hi);
+    CHECK(SVL::parallel_minmax_element(in.data(), n, SVL::nan_policy::ignore, threads) ==
+          std::make_pair(lo, hi));
+  }
+  in[n - 7] = std::numeric_limits<flt>::quiet_NaN();
+  CHECK(SVL::parallel_argmin(in.data(), n, SVL::nan_policy::propagate, 4) == n - 7);
+  CHECK(SVL::parallel_argmin(in.data(), n, SVL::nan_policy::ignore, 4) == lo);
+}
+TEST_SUITE_END();
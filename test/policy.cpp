@@ -0,0 +1,168 @@
+// Real SSE code has no fused multiply add, so keep the compiler from fusing
+// the separate multiply and add of the sse fma and hiding its extra rounding
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+#include "ulp.h"
+
+// Samples the whole float range (every sign and exponent) with a prime stride
+// between bit patterns and checks each policy against its documented bound
+static const u64 stride = 997;
+static const u64 all_floats = u64(1) << 32;
+
+template <typename V>
+static void check_policy_ulp(const char* name, V (*f)(const V&),
+                             double (*ref)(double), double bound) {
+  ErrorStats stats = sweep_floats<V>(0, all_floats, stride, f, ref,
+                                     [](float) { return true; }, ulp_error);
+  MESSAGE(name << ": max " << stats.max << " ULP at " << stats.worst_input
+          << ", mean " << stats.mean() << " ULP");
+  CAPTURE(name);
+  CAPTURE(stats.worst_input);
+  CHECK(stats.max <= bound);
+}
+
+template <typename V, typename U>
+static void check_policy_rel(const char* name, V (*f)(const V&),
+                             double (*ref)(double), U use_input, double bound) {
+  ErrorStats stats = sweep_floats<V>(0, all_floats, stride, f, ref, use_input,
+                                     relative_error);
+  MESSAGE(name << ": max relative error 2^" << std::log2(stats.max) << " at "
+          << stats.worst_input);
+  CAPTURE(name);
+  CAPTURE(stats.worst_input);
+  CHECK(stats.max <= bound);
+}
+
+static double ref_sin(double x) { return std::sin(x); }
+static double ref_cos(double x) { return std::cos(x); }
+static double ref_exp(double x) { return std::exp(x); }
+static double ref_log(double x) { return std::log(x); }
+static double ref_atan(double x) { return std::atan(x); }
+static double ref_tanh(double x) { return std::tanh(x); }
+static double ref_sinh(double x) { return std::sinh(x); }
+static double ref_cosh(double x) { return std::cosh(x); }
+static double ref_erf(double x) { return std::erf(x); }
+static double ref_erfc(double x) { return std::erfc(x); }
+static double ref_cbrt(double x) { return std::cbrt(x); }
+static double ref_lgamma(double x) { return std::lgamma(x); }
+static double ref_hypot(double x, double y) { return std::hypot(x, y); }
+
+//! Check lgamma in ULP for x > 0 and against lgamma_error for x < 0, or
+//! everywhere against lgamma_error if ulp_bound is 0
+template <typename V>
+static void check_lgamma(const char* name, V (*f)(const V&), double ulp_bound,
+                         double bound) {
+  auto normal = [](float x) { return !(std::fabs(x) < 1.17549435e-38f); };
+  u64 negative = ulp_bound > 0. ? all_floats / 2 : 0;
+  if (ulp_bound > 0.) {
+    ErrorStats stats = sweep_floats<V>(0, negative, stride, f, ref_lgamma,
+                                       [](float) { return true; }, ulp_error);
+    MESSAGE(name << " x > 0: max " << stats.max << " ULP at "
+            << stats.worst_input);
+    CAPTURE(stats.worst_input);
+    CHECK(stats.max <= ulp_bound);
+  }
+  ErrorStats stats = sweep_floats<V>(negative, all_floats, stride, f,
+                                     ref_lgamma, normal, lgamma_error);
+  MESSAGE(name << ": max error 2^" << std::log2(stats.max) << " at "
+          << stats.worst_input);
+  CAPTURE(name);
+  CAPTURE(stats.worst_input);
+  CHECK(stats.max <= bound);
+}
+
+//! Check hypot on random pairs of floats
+template <typename V>
+static void check_hypot(const char* name, V (*f)(const V&, const V&),
+                        double bound) {
+  ErrorStats stats = sample_pairs_parallel<V>(u64(1) << 22, 1, f, ref_hypot,
+                                              [](float, float) { return true; },
+                                              ulp_error);
+  MESSAGE(name << ": max " << stats.max << " ULP at " << stats.worst_input);
+  CAPTURE(name);
+  CAPTURE(stats.worst_input);
+  CHECK(stats.max <= bound);
+}
+
+TEST_SUITE_BEGIN("Math policies");
+TEST_CASE_TEMPLATE("precise policy", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector8f, SVL::avx2::Vector8f) {
+  check_policy_ulp<V>("precise::sin", SVL::precise::sin<V>, ref_sin, 0.5001);
+  check_policy_ulp<V>("precise::cos", SVL::precise::cos<V>, ref_cos, 0.5001);
+  check_policy_ulp<V>("precise::exp", SVL::precise::exp<V>, ref_exp, 0.5001);
+  check_policy_ulp<V>("precise::log", SVL::precise::log<V>, ref_log, 0.5001);
+  check_policy_ulp<V>("precise::atan", SVL::precise::atan<V>, ref_atan, 0.5001);
+  check_policy_ulp<V>("precise::tanh", SVL::precise::tanh<V>, ref_tanh, 0.5001);
+  check_policy_ulp<V>("precise::sinh", SVL::precise::sinh<V>, ref_sinh, 0.5001);
+  check_policy_ulp<V>("precise::cosh", SVL::precise::cosh<V>, ref_cosh, 0.5001);
+  check_policy_ulp<V>("precise::erf", SVL::precise::erf<V>, ref_erf, 0.5001);
+  check_policy_ulp<V>("precise::erfc", SVL::precise::erfc<V>, ref_erfc, 0.5001);
+  check_policy_ulp<V>("precise::cbrt", SVL::precise::cbrt<V>, ref_cbrt, 0.5001);
+  check_policy_ulp<V>("precise::lgamma", SVL::precise::lgamma<V>, ref_lgamma,
+                      0.5001);
+  check_hypot<V>("precise::hypot", SVL::precise::hypot<V>, 0.5001);
+}
+
+TEST_CASE_TEMPLATE("fast policy", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector8f, SVL::avx2::Vector8f) {
+  check_policy_ulp<V>("fast::sin", SVL::fast::sin<V>, ref_sin, 3.);
+  check_policy_ulp<V>("fast::cos", SVL::fast::cos<V>, ref_cos, 3.);
+  check_policy_ulp<V>("fast::exp", SVL::fast::exp<V>, ref_exp, 3.);
+  check_policy_ulp<V>("fast::log", SVL::fast::log<V>, ref_log, 3.);
+  check_policy_ulp<V>("fast::atan", SVL::fast::atan<V>, ref_atan, 3.);
+  check_policy_ulp<V>("fast::tanh", SVL::fast::tanh<V>, ref_tanh, 3.);
+  check_policy_ulp<V>("fast::sinh", SVL::fast::sinh<V>, ref_sinh, 3.);
+  check_policy_ulp<V>("fast::cosh", SVL::fast::cosh<V>, ref_cosh, 3.);
+  check_policy_ulp<V>("fast::erf", SVL::fast::erf<V>, ref_erf, 3.);
+  check_policy_ulp<V>("fast::erfc", SVL::fast::erfc<V>, ref_erfc, 7.);
+  check_policy_ulp<V>("fast::cbrt", SVL::fast::cbrt<V>, ref_cbrt, 1.);
+  check_lgamma<V>("fast::lgamma", SVL::fast::lgamma<V>, 5., std::exp2(-19.));
+  check_hypot<V>("fast::hypot", SVL::fast::hypot<V>, 1.5);
+}
+
+TEST_CASE_TEMPLATE("approx policy", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector8f, SVL::avx2::Vector8f) {
+  // Relative error is only meaningful for normal inputs and results, and
+  // approx sin/cos do not reduce beyond fast_trig_limit
+  auto trig = [](float x) { return std::fabs(x) < SVL::fast_trig_limit; };
+  auto normal = [](float x) { return !(std::fabs(x) < 1.17549435e-38f); };
+  auto normal_exp = [](float x) { return !(x < -87.33f); };
+  auto all = [](float) { return true; };
+  check_policy_rel<V>("approx::exp", SVL::approx::exp<V>, ref_exp, normal_exp,
+                      std::exp2(-17.));
+  check_policy_rel<V>("approx::log", SVL::approx::log<V>, ref_log, normal,
+                      std::exp2(-16.));
+  check_policy_rel<V>("approx::atan", SVL::approx::atan<V>, ref_atan, all,
+                      std::exp2(-14.5));
+  check_policy_rel<V>("approx::tanh", SVL::approx::tanh<V>, ref_tanh, normal,
+                      std::exp2(-18.5));
+  check_policy_rel<V>("approx::sinh", SVL::approx::sinh<V>, ref_sinh, normal,
+                      std::exp2(-17.));
+  check_policy_rel<V>("approx::cosh", SVL::approx::cosh<V>, ref_cosh, all,
+                      std::exp2(-17.));
+  check_policy_rel<V>("approx::erf", SVL::approx::erf<V>, ref_erf, normal,
+                      std::exp2(-19.5));
+  // erfc results are denormal beyond 9.1
+  check_policy_rel<V>("approx::erfc", SVL::approx::erfc<V>, ref_erfc,
+                      [](float x) { return !(x > 9.1f); }, std::exp2(-17.));
+  check_policy_rel<V>("approx::cbrt", SVL::approx::cbrt<V>, ref_cbrt, normal,
+                      std::exp2(-18.));
+  check_lgamma<V>("approx::lgamma", SVL::approx::lgamma<V>, 0., std::exp2(-16.));
+  // sin and cos near their zeros are only accurate in absolute terms
+  for (auto f : { SVL::approx::sin<V>, SVL::approx::cos<V> }) {
+    double (*ref)(double) = (f == SVL::approx::sin<V>) ? ref_sin : ref_cos;
+    ErrorStats stats = sweep_floats<V>(0, all_floats, stride, f, ref, trig,
+      [](float got, double expected) { return std::fabs(got - expected); });
+    MESSAGE("approx::" << (ref == ref_sin ? "sin" : "cos")
+            << ": max absolute error 2^" << std::log2(stats.max));
+    CAPTURE(stats.worst_input);
+    CHECK(stats.max <= std::exp2(-19.));
+  }
+}
+TEST_SUITE_END();
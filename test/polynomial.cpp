@@ -0,0 +1,62 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <iterator>
+
+static constexpr flt one[] = { 0.75f };
+static constexpr flt three[] = { 1.f, -0.5f, 0.25f };
+static constexpr flt five[] = { 0.5f, 1.25f, -2.f, 0.125f, 3.f };
+static constexpr flt nine[] = { 1.f, -1.f, 0.5f, 0.25f, -0.125f, 2.f, -3.f, 0.0625f, 1.5f };
+static constexpr flt denominator[] = { 2.f, 0.f, 1.f };
+
+// The polynomial in double precision
+template <const auto& C>
+static double reference(double x) {
+  double r = 0.0;
+  for (i64 i = i64(std::size(C)) - 1; i >= 0; --i) r = r * x + C[i];
+  return r;
+}
+
+template <const auto& C, typename V>
+static void check_polynomial() {
+  flt in[V::step];
+  SVL_FOR_RANGE(V::step) in[i] = -1.f + 2.f * flt(i) / flt(V::step);
+  const V x(in);
+  V by_horner = SVL::horner<C>(x), by_estrin = SVL::estrin<C>(x), by_polyval = SVL::polyval<C>(x);
+  // Run time coefficients are Horner's rule in the same order
+  V by_runtime = SVL::polyval(x, C, i64(std::size(C)));
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(in[i]);
+    double ref = reference<C>(in[i]);
+    CHECK(by_horner[i] == doctest::Approx(ref).epsilon(1e-6));
+    CHECK(by_estrin[i] == doctest::Approx(ref).epsilon(1e-6));
+    CHECK(by_polyval[i] == doctest::Approx(ref).epsilon(1e-6));
+    CHECK(by_runtime[i] == by_horner[i]);
+  }
+}
+
+TEST_SUITE_BEGIN("Polynomial");
+TEST_CASE_TEMPLATE("horner and estrin", V, SVL::scalar::Vector4f, SVL::scalar::Vector16f,
+                   SVL::sse::Vector4f, SVL::sse::Vector8f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  check_polynomial<one, V>();
+  check_polynomial<three, V>();
+  check_polynomial<five, V>();
+  check_polynomial<nine, V>();
+  CHECK(SVL::polyval(V(2.f), nine, 0)[0] == 0.f);
+}
+
+TEST_CASE_TEMPLATE("rational", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f) {
+  flt in[V::step];
+  SVL_FOR_RANGE(V::step) in[i] = flt(i) * 0.375f - 1.f;
+  V fixed = SVL::rational<five, denominator>(V(in));
+  V runtime = SVL::rational(V(in), five, 5, denominator, 3);
+  SVL_FOR_RANGE(V::step) {
+    CAPTURE(in[i]);
+    double ref = reference<five>(in[i]) / reference<denominator>(in[i]);
+    CHECK(fixed[i] == doctest::Approx(ref).epsilon(1e-6));
+    CHECK(runtime[i] == doctest::Approx(ref).epsilon(1e-6));
+  }
+}
+TEST_SUITE_END();
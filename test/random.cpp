@@ -0,0 +1,199 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//! Reference xoshiro256+, as published by Blackman and Vigna
+struct Xoshiro {
+  u64 s[4];
+
+  static u64 rotl(u64 x, int k) { return (x << k) | (x >> (64 - k)); }
+  u64 next() {
+    const u64 result = s[0] + s[3], t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+  }
+  void jump(const u64* polynomial) {
+    u64 t[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; ++i)
+      for (int b = 0; b < 64; ++b) {
+        if (polynomial[i] & (u64(1) << b))
+          for (int j = 0; j < 4; ++j) t[j] ^= s[j];
+        next();
+      }
+    for (int j = 0; j < 4; ++j) s[j] = t[j];
+  }
+};
+
+static const u64 jump_128[4] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
+                                 0x39abdc4529b1661c };
+static const u64 jump_192[4] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241,
+                                 0x39109bb02acbe635 };
+
+//! The reference generator of each lane of Random<V>(seed)
+template <typename V>
+static std::vector<Xoshiro> reference_lanes(u64 seed) {
+  Xoshiro x;
+  for (u64& v : x.s) {
+    // splitmix64
+    u64 z = (seed += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    v = z ^ (z >> 31);
+  }
+  std::vector<Xoshiro> lanes;
+  for (i64 l = 0; l < V::bits_t::step; ++l) {
+    lanes.push_back(x);
+    x.jump(jump_128);
+  }
+  return lanes;
+}
+
+//! Whether the next count outputs of each lane of rng match lanes
+template <typename V>
+static bool matches(SVL::Random<V>& rng, std::vector<Xoshiro>& lanes, i64 count) {
+  bool same = true;
+  u64 bits[V::bits_t::step];
+  for (i64 i = 0; i < count; ++i) {
+    rng.next_bits().store(bits);
+    for (i64 l = 0; l < V::bits_t::step; ++l) same &= bits[l] == lanes[l].next();
+  }
+  return same;
+}
+
+TEST_SUITE_BEGIN("Random");
+TEST_CASE_TEMPLATE("lanes follow xoshiro256+", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (u64 seed : { u64(0), u64(42), ~u64(0) }) {
+    CAPTURE(seed);
+    SVL::Random<V> rng(seed);
+    std::vector<Xoshiro> lanes = reference_lanes<V>(seed);
+    CHECK(matches(rng, lanes, 100));
+
+    // Long jumps move each lane 2^192 steps along
+    rng.long_jump();
+    for (Xoshiro& x : lanes) x.jump(jump_192);
+    CHECK(matches(rng, lanes, 100));
+
+    // Streams are long jumps from the start
+    SVL::Random<V> stream(seed, 2);
+    lanes = reference_lanes<V>(seed);
+    for (Xoshiro& x : lanes) {
+      x.jump(jump_192);
+      x.jump(jump_192);
+    }
+    CHECK(matches(stream, lanes, 100));
+  }
+}
+
+TEST_CASE_TEMPLATE("uniform floats", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  // Each float takes the top 23 bits of its half of a lane's output
+  SVL::Random<V> rng(7);
+  std::vector<Xoshiro> lanes = reference_lanes<V>(7);
+  flt u[V::step];
+  for (i64 i = 0; i < 50; ++i) {
+    rng.uniform().store(u);
+    for (i64 l = 0; l < V::bits_t::step; ++l) {
+      const u64 x = lanes[l].next();
+      CHECK(u[2 * l] == flt((x >> 9) & 0x7fffff) * 0x1p-23f);
+      CHECK(u[2 * l + 1] == flt(x >> 41) * 0x1p-23f);
+    }
+  }
+
+  // Moments and a histogram of fill_uniform
+  const i64 n = (i64(1) << 20) + 3, bins = 32;
+  std::vector<flt> x(n);
+  rng.fill_uniform(n, x.data(), -2.f, 6.f);
+  dbl sum = 0., squares = 0.;
+  std::vector<i64> counts(bins, 0);
+  bool in_range = true;
+  for (flt v : x) {
+    in_range &= v >= -2.f && v < 6.f;
+    sum += v;
+    squares += dbl(v) * v;
+    ++counts[SVL_CLAMP(0, i64((v + 2.f) / 8.f * bins), bins - 1)];
+  }
+  CHECK(in_range);
+  const dbl mean = sum / dbl(n), variance = squares / dbl(n) - mean * mean;
+  CHECK(mean == doctest::Approx(2.).epsilon(0.005));
+  CHECK(variance == doctest::Approx(64. / 12.).epsilon(0.005));
+  // Within 5 standard deviations of the expected count
+  const dbl expected = dbl(n) / dbl(bins), sigma = std::sqrt(expected * (1. - 1. / dbl(bins)));
+  for (i64 b = 0; b < bins; ++b) {
+    CAPTURE(b);
+    CHECK(std::abs(dbl(counts[b]) - expected) < 5. * sigma);
+  }
+}
+
+TEST_CASE_TEMPLATE("normal floats", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  const i64 n = (i64(1) << 20) + 5;
+  std::vector<flt> x(n);
+  SVL::Random<V> rng(11);
+  rng.fill_normal(n, x.data(), 1.f, 3.f);
+  dbl moments[5] = { 0., 0., 0., 0., 0. };
+  i64 within_one = 0;
+  bool finite = true;
+  for (flt v : x) {
+    const dbl z = (dbl(v) - 1.) / 3.;
+    finite &= std::isfinite(v);
+    within_one += std::abs(z) < 1.;
+    for (dbl& m : moments) m += std::pow(z, &m - moments) / dbl(n);
+  }
+  CHECK(finite);
+  CHECK(std::abs(moments[1]) < 0.005);
+  CHECK(moments[2] == doctest::Approx(1.).epsilon(0.005));
+  CHECK(std::abs(moments[3]) < 0.02);
+  CHECK(moments[4] == doctest::Approx(3.).epsilon(0.02));
+  CHECK(dbl(within_one) / dbl(n) == doctest::Approx(0.682689).epsilon(0.005));
+
+  // normal returns the same samples one register at a time, the second of
+  // each pair after the first
+  SVL::Random<V> again(11);
+  flt z[V::step];
+  for (i64 i = 0; i + i64(V::step) <= 64 * V::step; i += V::step) {
+    again.normal().store(z);
+    for (i64 l = 0; l < V::step; ++l) CHECK(1.f + 3.f * z[l] == doctest::Approx(x[i + l]));
+  }
+}
+
+TEST_CASE_TEMPLATE("fills stop at n", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  const flt guard = 1234.f;
+  for (i64 n = 0; n <= 3 * i64(V::step) + 1; ++n) {
+    CAPTURE(n);
+    std::vector<flt> x(n + V::step, guard);
+    SVL::Random<V> rng(3);
+    rng.fill_uniform(n, x.data());
+    for (i64 i = 0; i < n; ++i) CHECK((x[i] >= 0.f && x[i] < 1.f));
+    for (i64 i = n; i < i64(x.size()); ++i) CHECK(x[i] == guard);
+
+    std::fill(x.begin(), x.end(), guard);
+    rng.fill_normal(n, x.data());
+    for (i64 i = 0; i < n; ++i) CHECK(std::abs(x[i]) < 10.f);
+    for (i64 i = n; i < i64(x.size()); ++i) CHECK(x[i] == guard);
+  }
+}
+
+TEST_CASE("streams and lanes differ") {
+  SVL::Random<SVL::avx2::Vector8f> a(5), b(5, 1), c(6);
+  flt x[8], y[8], z[8];
+  a.uniform().store(x);
+  b.uniform().store(y);
+  c.uniform().store(z);
+  i64 same = 0;
+  for (i64 l = 0; l < 8; ++l) {
+    same += x[l] == y[l] || x[l] == z[l];
+    for (i64 k = 0; k < l; ++k) same += x[k] == x[l];
+  }
+  CHECK(same == 0);
+}
+TEST_SUITE_END();
@@ -0,0 +1,84 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// Small integers, so float sums are exact whatever the order of the additions
+template <typename T>
+static std::vector<T> scan_input(i64 n) {
+  std::mt19937 gen{ u32(n) };
+  std::uniform_int_distribution<int> dis(-100, 100);
+  std::vector<T> v(n);
+  for (T& x : v) x = T(dis(gen));
+  return v;
+}
+
+TEST_SUITE_BEGIN("Scan");
+TEST_CASE_TEMPLATE("prefix_sum", V, SVL::scalar::Vector4f, SVL::scalar::Vector8f,
+                   SVL::scalar::Vector16f, SVL::sse::Vector4f, SVL::sse::Vector8f,
+                   SVL::sse::Vector16f, SVL::avx2::Vector4f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f, SVL::scalar::Vector32i16,
+                   SVL::sse::Vector8i16, SVL::sse::Vector32i16,
+                   SVL::avx2::Vector16i16, SVL::avx2::Vector32i16,
+                   SVL::scalar::Vector8i64, SVL::sse::Vector2i64,
+                   SVL::sse::Vector8u64, SVL::avx2::Vector4i64,
+                   SVL::avx2::Vector4u64, SVL::avx2::Vector8i64) {
+  using T = typename V::scalar_t;
+  std::vector<T> in = scan_input<T>(V::step);
+  in[0] = std::numeric_limits<T>::max();
+  V sums = prefix_sum(V(in.data()));
+  T total = 0;
+  SVL_FOR_RANGE(V::step) {
+    // Wraps around from max, so integers are added in the unsigned type
+    if constexpr (std::is_integral_v<T>)
+      total = T(std::make_unsigned_t<T>(total) + std::make_unsigned_t<T>(in[i]));
+    else total = T(total + in[i]);
+    CAPTURE(i);
+    CHECK(sums[i] == total);
+  }
+}
+
+TEST_CASE_TEMPLATE("inclusive and exclusive scans", V, SVL::scalar::Vector8f,
+                   SVL::sse::Vector4f, SVL::avx2::Vector8f, SVL::avx2::Vector16i16,
+                   SVL::avx2::Vector4i64) {
+  using T = typename V::scalar_t;
+  for (i64 n : { 0, 1, 3, 16, 17, 1000 }) {
+    CAPTURE(n);
+    std::vector<T> in = scan_input<T>(n), incl(n + 1, T(77)), excl(n + 1, T(77));
+    std::vector<T> ref(n + 1, T(5));
+    SVL_FOR_RANGE(n) ref[i + 1] = T(ref[i] + in[i]);
+
+    CHECK(SVL::inclusive_scan<V>(incl.data(), in.data(), n, T(5)) == ref[n]);
+    CHECK(SVL::exclusive_scan<V>(excl.data(), in.data(), n, T(5)) == ref[n]);
+    SVL_FOR_RANGE(n) {
+      CAPTURE(i);
+      CHECK(incl[i] == ref[i + 1]);
+      CHECK(excl[i] == ref[i]);
+    }
+    CHECK(incl[n] == T(77));
+    CHECK(excl[n] == T(77));
+
+    // In place
+    std::vector<T> inplace = in;
+    SVL::exclusive_scan<V>(inplace.data(), inplace.data(), n, T(5));
+    CHECK(std::equal(inplace.begin(), inplace.end(), ref.begin()));
+  }
+}
+
+TEST_CASE_TEMPLATE("parallel scans", V, SVL::avx2::Vector8f, SVL::avx2::Vector4i64) {
+  using T = typename V::scalar_t;
+  const i64 n = 300001;
+  std::vector<T> in = scan_input<T>(n), incl(n), excl(n), ref(n + 1, T(-3));
+  SVL_FOR_RANGE(n) ref[i + 1] = ref[i] + in[i];
+  for (i64 threads : { 1, 3, 8 }) {
+    CAPTURE(threads);
+    SVL::parallel_inclusive_scan<V>(incl.data(), in.data(), n, T(-3), threads);
+    SVL::parallel_exclusive_scan<V>(excl.data(), in.data(), n, T(-3), threads);
+    CHECK(std::equal(incl.begin(), incl.end(), ref.begin() + 1));
+    CHECK(std::equal(excl.begin(), excl.end(), ref.begin()));
+  }
+}
+TEST_SUITE_END();
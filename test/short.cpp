@@ -0,0 +1,95 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <random>
+
+// Fills a and b with random values, including the extremes
+template <typename V>
+static void random_shorts(i16* a, i16* b) {
+  std::mt19937 gen(V::step);
+  std::uniform_int_distribution<int> dis(-32768, 32767);
+  SVL_FOR_RANGE(V::step) {
+    a[i] = i16(dis(gen));
+    b[i] = i16(dis(gen));
+  }
+  a[0] = 32767; b[0] = 32767;
+  a[1] = -32768; b[1] = -32768;
+  a[2] = -32768; b[2] = 32767;
+  a[3] = b[3];
+}
+
+TEST_SUITE_BEGIN("Veci16");
+TEST_CASE_TEMPLATE("Veci16 arithmetic", V, SVL::scalar::Vector8i16,
+                   SVL::scalar::Vector16i16, SVL::scalar::Vector32i16,
+                   SVL::sse::Vector8i16, SVL::sse::Vector16i16,
+                   SVL::sse::Vector32i16, SVL::avx2::Vector8i16,
+                   SVL::avx2::Vector16i16, SVL::avx2::Vector32i16) {
+  i16 a[V::step], b[V::step];
+  random_shorts<V>(a, b);
+  V va(a), vb(b);
+
+  struct Op { const char* name; V result; i16 (*ref)(i16, i16); };
+  const Op ops[] = {
+    { "+", va + vb, [](i16 x, i16 y) { return i16(x + y); } },
+    { "-", va - vb, [](i16 x, i16 y) { return i16(x - y); } },
+    { "*", va * vb, [](i16 x, i16 y) { return i16(x * y); } },
+    { "negate", -va, [](i16 x, i16) { return i16(-x); } },
+    { "abs", abs(va), [](i16 x, i16) { return i16(x < 0 ? -x : x); } },
+    { "add_saturated", add_saturated(va, vb),
+      [](i16 x, i16 y) { return i16(SVL_CLAMP(-32768, x + y, 32767)); } },
+    { "sub_saturated", sub_saturated(va, vb),
+      [](i16 x, i16 y) { return i16(SVL_CLAMP(-32768, x - y, 32767)); } },
+    { "avg", avg(va, vb), [](i16 x, i16 y) { return i16((x + y + 1) >> 1); } },
+    { "min", min(va, vb), [](i16 x, i16 y) { return SVL_MIN(x, y); } },
+    { "max", max(va, vb), [](i16 x, i16 y) { return SVL_MAX(x, y); } },
+    { "mulhi", mulhi(va, vb), [](i16 x, i16 y) { return i16((x * y) >> 16); } },
+    { "==", va == vb, [](i16 x, i16 y) { return i16(x == y ? -1 : 0); } },
+    { "!=", va != vb, [](i16 x, i16 y) { return i16(x != y ? -1 : 0); } },
+    { "<", va < vb, [](i16 x, i16 y) { return i16(x < y ? -1 : 0); } },
+    { "<=", va <= vb, [](i16 x, i16 y) { return i16(x <= y ? -1 : 0); } },
+    { ">", va > vb, [](i16 x, i16 y) { return i16(x > y ? -1 : 0); } },
+    { ">=", va >= vb, [](i16 x, i16 y) { return i16(x >= y ? -1 : 0); } },
+    { "blend", blend(va, vb, va < vb), [](i16 x, i16 y) { return x < y ? x : y; } },
+    { "and_not", and_not(va, vb), [](i16 x, i16 y) { return i16(~x & y); } },
+  };
+  for (const Op& op : ops) {
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(op.name);
+      CAPTURE(i);
+      CHECK(op.result[i] == op.ref(a[i], b[i]));
+    }
+  }
+
+  for (i32 n : { 0, 1, 5, 15, 16 }) {
+    V left = va << n, right = va >> n, logical = shift_right_logical(va, n);
+    SVL_FOR_RANGE(V::step) {
+      CAPTURE(n);
+      CAPTURE(i);
+      CHECK(left[i] == i16(n < 16 ? u16(a[i]) << n : 0));
+      CHECK(right[i] == i16(a[i] >> SVL_MIN(n, 15)));
+      CHECK(logical[i] == i16(n < 16 ? u16(a[i]) >> n : 0));
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("Veci16 load and store", V, SVL::scalar::Vector8i16,
+                   SVL::scalar::Vector32i16, SVL::sse::Vector8i16,
+                   SVL::sse::Vector32i16, SVL::avx2::Vector16i16,
+                   SVL::avx2::Vector32i16) {
+  i16 a[V::step], b[V::step], out[V::step + 1];
+  random_shorts<V>(a, b);
+  for (i64 n = 0; n <= V::step; ++n) {
+    CAPTURE(n);
+    out[n] = 12345;
+    V v = V().load_partial(a, n);
+    v.store_partial(out, n);
+    SVL_FOR_RANGE(V::step) CHECK(v[i] == (i < n ? a[i] : 0));
+    SVL_FOR_RANGE(n) CHECK(out[i] == a[i]);
+    CHECK(out[n] == 12345);
+  }
+  V v(a);
+  v.assign(-42, V::step - 1);
+  CHECK(v[V::step - 1] == -42);
+  CHECK(V(i16(-7))[V::step / 2] == -7);
+}
+TEST_SUITE_END();
@@ -0,0 +1,77 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Random keys with plenty of duplicates
+static std::vector<flt> sort_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_int_distribution<int> dis(-1000, 1000);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = flt(dis(gen)) * 0.25f;
+  return v;
+}
+
+TEST_SUITE_BEGIN("Sort");
+TEST_CASE_TEMPLATE("Vecf sorting networks", V, SVL::scalar::Vector4f,
+                   SVL::scalar::Vector8f, SVL::scalar::Vector16f,
+                   SVL::sse::Vector4f, SVL::sse::Vector8f, SVL::sse::Vector16f,
+                   SVL::avx2::Vector4f, SVL::avx2::Vector8f,
+                   SVL::avx2::Vector16f) {
+  for (u32 seed = 0; seed < 200; ++seed) {
+    CAPTURE(seed);
+    std::vector<flt> x = sort_input(2 * V::step, seed);
+    if (seed % 2) for (flt& f : x) f = flt(int(f) % 3);
+    std::vector<flt> sorted(x.begin(), x.begin() + V::step);
+    std::sort(sorted.begin(), sorted.end());
+    flt out[V::step];
+    sort(V(x.data())).store(out);
+    CHECK(std::equal(sorted.begin(), sorted.end(), out));
+
+    // Payloads are the original positions
+    flt idx[2 * V::step];
+    SVL_FOR_RANGE(2 * V::step) idx[i] = flt(i);
+    V k(x.data()), v(idx);
+    sort(k, v);
+    SVL_FOR_RANGE(V::step) {
+      CHECK(k[i] == sorted[i]);
+      CHECK(x[i64(v[i])] == k[i]);
+    }
+
+    V a = sort(V(x.data())), b = sort(V(x.data() + V::step));
+    merge_sorted(a, b);
+    std::sort(x.begin(), x.end());
+    SVL_FOR_RANGE(V::step) {
+      CHECK(a[i] == x[i]);
+      CHECK(b[i] == x[i + V::step]);
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE("array sort", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 n : { 0, 1, 5, 8, 16, 17, 100, 1000, 8192, 8199, 20000, 50001 }) {
+    CAPTURE(n);
+    std::vector<flt> keys = sort_input(n, u32(n)), sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<flt> copy = keys;
+    SVL::sort<V>(copy.data(), n);
+    CHECK(copy == sorted);
+
+    std::vector<u32> perm(n);
+    SVL_FOR_RANGE(n) perm[i] = u32(i);
+    copy = keys;
+    SVL::sort<V>(copy.data(), perm.data(), n);
+    CHECK(copy == sorted);
+    bool permuted = true;
+    std::vector<bool> seen(n, false);
+    SVL_FOR_RANGE(n) {
+      permuted = permuted && perm[i] < n && !seen[perm[i]] && keys[perm[i]] == copy[i];
+      if (perm[i] < n) seen[perm[i]] = true;
+    }
+    CHECK(permuted);
+  }
+}
+TEST_SUITE_END();
@@ -0,0 +1,74 @@
+#include <doctest/doctest.h>
+#include <SVL/SVL.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Integers up to 2^20 scaled by 2^-6 to 2^6, and pairs of large values that
+// cancel, so the exact sums and products fit in a long double but float
+// sums lose digits
+static std::vector<flt> summation_input(i64 n, u32 seed) {
+  std::mt19937 gen{ seed };
+  std::uniform_int_distribution<int> mantissa(-(1 << 20), 1 << 20), exponent(-6, 6);
+  std::vector<flt> v(n);
+  for (flt& x : v) x = std::ldexp(flt(mantissa(gen)), exponent(gen));
+  for (i64 i = 0; i + 40 < n; i += 97) {
+    v[i] = 3e10f;
+    v[i + 40] = -3e10f;
+  }
+  return v;
+}
+
+// Within two roundings of the exact value
+static bool nearly(flt result, long double exact) {
+  return std::abs((long double)result - exact) <=
+         2 * std::numeric_limits<flt>::epsilon() * std::abs(exact);
+}
+
+TEST_SUITE_BEGIN("Summation");
+TEST_CASE_TEMPLATE("compensated sums", V, SVL::scalar::Vector8f, SVL::sse::Vector4f,
+                   SVL::sse::Vector8f, SVL::avx2::Vector8f, SVL::avx2::Vector16f) {
+  for (i64 n : { 0, 1, 7, 33, 1000, 100003 }) {
+    CAPTURE(n);
+    std::vector<flt> x = summation_input(n, 1), y = summation_input(n, 2);
+    long double sum = 0, dot = 0;
+    SVL_FOR_RANGE(n) {
+      sum += x[i];
+      dot += (long double)x[i] * y[i];
+    }
+    CHECK(nearly(SVL::compensated_sum<V>(n, x.data()), sum));
+    CHECK(nearly(SVL::compensated_dot<V>(n, x.data(), y.data()), dot));
+    // Only checks it adds up, the error bound is much looser
+    if (n < 100) CHECK(nearly(SVL::pairwise_sum<V>(n, x.data()), sum));
+  }
+}
+
+TEST_CASE_TEMPLATE("pairwise sum", V, SVL::scalar::Vector4f, SVL::sse::Vector4f,
+                   SVL::avx2::Vector8f) {
+  // Small integers, so the sum is exact in any order
+  for (i64 n : { 0, 5, 256, 257, 10000 }) {
+    CAPTURE(n);
+    std::vector<flt> x(n);
+    SVL_FOR_RANGE(n) x[i] = flt(i % 17) - 8.f;
+    flt sum = 0.f;
+    for (flt xi : x) sum += xi;
+    CHECK(SVL::pairwise_sum<V>(n, x.data()) == sum);
+  }
+  // A million copies of 0.1 drift far from 10^5 when added in turn
+  std::vector<flt> tenths(1000000, 0.1f);
+  long double exact = 1000000.0L * 0.1f;
+  CHECK(std::abs((long double)SVL::pairwise_sum<V>(1000000, tenths.data()) - exact) < 0.01L);
+  CHECK(nearly(SVL::compensated_sum<V>(1000000, tenths.data()), exact));
+}
+
+TEST_CASE("non finite sums") {
+  std::vector<flt> x(50, 1.f);
+  x[20] = std::numeric_limits<flt>::infinity();
+  CHECK(SVL::compensated_sum(50, x.data()) == std::numeric_limits<flt>::infinity());
+  CHECK(SVL::compensated_dot(50, x.data(), x.data()) == std::numeric_limits<flt>::infinity());
+  x[30] = -std::numeric_limits<flt>::infinity();
+  CHECK(std::isnan(SVL::compensated_sum(50, x.data())));
+}
+TEST_SUITE_END();
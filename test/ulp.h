@@ -0,0 +1,180 @@
+#pragma once
+
+#include <SVL/SVL.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+//! Float with the given bit pattern
+inline float float_from_bits(u32 bits) {
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+//! Error of got in units in the last place of the exact result expected
+inline double ulp_error(float got, double expected) {
+  if (std::isnan(got) || std::isnan(expected))
+    return (std::isnan(got) && std::isnan(expected)) ? 0. : HUGE_VAL;
+  if (std::isinf(got) || std::isinf(expected))
+    return ((float)expected == got) ? 0. : HUGE_VAL;
+  int e = expected == 0. ? -126 : SVL_MAX(std::ilogb(expected), -126);
+  return std::fabs(got - expected) / std::ldexp(1., e - 23);
+}
+
+//! Relative error of got compared to the exact result expected
+inline double relative_error(float got, double expected) {
+  if (std::isnan(got) || std::isnan(expected))
+    return (std::isnan(got) && std::isnan(expected)) ? 0. : HUGE_VAL;
+  if (std::isinf(got) || std::isinf(expected))
+    return ((float)expected == got) ? 0. : HUGE_VAL;
+  if (expected == 0.) return got == 0.f ? 0. : HUGE_VAL;
+  return std::fabs(got - expected) / std::fabs(expected);
+}
+
+//! Error relative to max(1, |expected|), for lgamma whose zeros at negative
+//! inputs are not exact
+inline double lgamma_error(float got, double expected) {
+  if (std::isnan(expected) || std::isinf((float)expected))
+    return ulp_error(got, expected);
+  return std::fabs(got - expected) / SVL_MAX(1., std::fabs(expected));
+}
+
+//! Accumulated error of a function over a set of inputs
+struct ErrorStats {
+  double max = 0.;
+  double sum = 0.;
+  u64 count = 0;
+  float worst_input = 0.f;
+
+  void add(double err, float input) {
+    if (err > max || (std::isnan(err) && !std::isnan(max))) {
+      max = err;
+      worst_input = input;
+    }
+    sum += err;
+    ++count;
+  }
+  void merge(const ErrorStats& o) {
+    if (o.max > max) {
+      max = o.max;
+      worst_input = o.worst_input;
+    }
+    sum += o.sum;
+    count += o.count;
+  }
+  double mean() const { return count ? sum / double(count) : 0.; }
+};
+
+//! Measure f against the double precision reference ref for every float whose
+//! bit pattern is in [begin, end) and a multiple of stride apart. Inputs for
+//! which use_input returns false are skipped. err is ulp_error or
+//! relative_error
+template <typename V, typename F, typename R, typename U, typename E>
+ErrorStats sweep_floats(u64 begin, u64 end, u64 stride, F f, R ref,
+                        U use_input, E err) {
+  ErrorStats stats;
+  float in[V::step], out[V::step];
+  u64 bits = begin;
+  while (bits < end) {
+    i64 n = 0;
+    for (; n < V::step && bits < end; bits += stride) {
+      float x = float_from_bits(u32(bits));
+      if (use_input(x)) in[n++] = x;
+    }
+    f(V().load_partial(in, n)).store_partial(out, n);
+    SVL_FOR_RANGE(n) stats.add(err(out[i], ref(double(in[i]))), in[i]);
+  }
+  return stats;
+}
+
+//! Number of threads used by the parallel sweeps
+inline unsigned sweep_threads() {
+  unsigned n = std::thread::hardware_concurrency();
+  return n ? n : 1;
+}
+
+//! sweep_floats with the range split evenly over all hardware threads
+template <typename V, typename F, typename R, typename U, typename E>
+ErrorStats sweep_floats_parallel(u64 begin, u64 end, u64 stride, F f, R ref,
+                                 U use_input, E err) {
+  unsigned n_threads = sweep_threads();
+  u64 n_inputs = (end - begin + stride - 1) / stride;
+  u64 per_thread = (n_inputs + n_threads - 1) / n_threads;
+  std::vector<ErrorStats> stats(n_threads);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < n_threads; ++t) {
+    u64 b = begin + SVL_MIN(t * per_thread, n_inputs) * stride;
+    u64 e = begin + SVL_MIN((t + 1) * per_thread, n_inputs) * stride;
+    threads.emplace_back([=, &stats] {
+      stats[t] = sweep_floats<V>(b, SVL_MIN(e, end), stride, f, ref, use_input,
+                                 err);
+    });
+  }
+  ErrorStats total;
+  for (unsigned t = 0; t < n_threads; ++t) {
+    threads[t].join();
+    total.merge(stats[t]);
+  }
+  return total;
+}
+
+//! Measure the binary function f against ref for count pairs of uniformly
+//! random bit patterns, split over all hardware threads. Pairs for which
+//! use_input returns false are skipped. The worst input recorded is the first
+//! argument
+template <typename V, typename F, typename R, typename U, typename E>
+ErrorStats sample_pairs_parallel(u64 count, u64 seed, F f, R ref, U use_input,
+                                 E err) {
+  unsigned n_threads = sweep_threads();
+  std::vector<ErrorStats> stats(n_threads);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < n_threads; ++t) {
+    u64 n_pairs = count / n_threads + (t < count % n_threads ? 1 : 0);
+    threads.emplace_back([=, &stats] {
+      std::mt19937 gen(u32(seed + t));
+      float a[V::step], b[V::step], out[V::step];
+      u64 done = 0;
+      while (done < n_pairs) {
+        i64 n = 0;
+        for (; n < V::step && done < n_pairs; ++done) {
+          float x = float_from_bits(gen()), y = float_from_bits(gen());
+          if (use_input(x, y)) {
+            a[n] = x;
+            b[n++] = y;
+          }
+        }
+        f(V().load_partial(a, n), V().load_partial(b, n)).store_partial(out, n);
+        SVL_FOR_RANGE(n)
+          stats[t].add(err(out[i], ref(double(a[i]), double(b[i]))), a[i]);
+      }
+    });
+  }
+  ErrorStats total;
+  for (unsigned t = 0; t < n_threads; ++t) {
+    threads[t].join();
+    total.merge(stats[t]);
+  }
+  return total;
+}
+
+//! Inputs every function must handle: NaN, +-Inf, +-0, denormals and the
+//! limits of the normal range
+static const float special_values[] = {
+  NAN, HUGE_VALF, -HUGE_VALF, 0.f, -0.f, 1.40129846e-45f, -1.40129846e-45f,
+  1.17549421e-38f, -1.17549421e-38f, 1.17549435e-38f, -1.17549435e-38f,
+  3.40282347e+38f, -3.40282347e+38f
+};
+
+//! Whether got is the same kind of value as the exact result expected: both
+//! NaN, the same infinity, the same signed zero, or both finite
+inline bool same_kind(float got, double expected) {
+  if (std::isnan(expected)) return std::isnan(got);
+  if (std::isinf(expected) || std::isinf((float)expected))
+    return got == (float)expected;
+  if (expected == 0.)
+    return got == 0.f && std::signbit(got) == std::signbit(expected);
+  return std::isfinite(got);
+}